@@ -218,15 +218,16 @@ int main(int argc, char* argv[])
     // Compute the real timestep. This may be less than dt for the last timestep.
     double dt_real = std::min(dt, t_final - t);
 
+    // Solve the physics module appropriately. With adaptive time stepping the step
+    // actually taken may be smaller than requested, and is returned in dt_real.
+    main_physics->advanceTimestep(dt_real);
+
     // Compute current time
     t = t + dt_real;
 
     // Print the timestep information
     SLIC_INFO_ROOT("step " << ti << ", t = " << t);
 
-    // Solve the physics module appropriately
-    main_physics->advanceTimestep(dt_real);
-
     // Output a visualization file
     main_physics->outputState();
 
@@ -0,0 +1,198 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/element_preconditioner.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac::mfem_ext {
+
+ElementSchwarzPreconditioner::ElementSchwarzPreconditioner(mfem::ParFiniteElementSpace&               pfes,
+                                                           std::function<const mfem::SparseMatrix&()> local_matrix,
+                                                           SchwarzOverlap                             overlap,
+                                                           const mfem::Array<int>*                    essential_tdofs)
+    : mfem::Solver(pfes.GetTrueVSize()),
+      pfes_(pfes),
+      local_matrix_(local_matrix),
+      overlap_(overlap),
+      essential_tdofs_(essential_tdofs)
+{
+  SLIC_ERROR_ROOT_IF(!local_matrix_, "ElementSchwarzPreconditioner requires a source for the element matrices");
+  BuildPatches();
+  r_L_.SetSize(pfes_.GetVSize());
+  z_L_.SetSize(pfes_.GetVSize());
+}
+
+void ElementSchwarzPreconditioner::AddPatch(const int* elements, int num_elements, std::vector<bool>& claimed)
+{
+  mfem::Array<int> vdofs;
+  auto             first = static_cast<int>(patch_dofs_.size());
+  for (int i = 0; i < num_elements; i++) {
+    pfes_.GetElementVDofs(elements[i], vdofs);
+    for (int signed_dof : vdofs) {
+      // mfem encodes the orientation of some DOFs in the sign of their index
+      int dof = (signed_dof >= 0) ? signed_dof : -1 - signed_dof;
+      if (patch_index_[static_cast<std::size_t>(dof)] >= 0) continue;
+      if (overlap_ == SchwarzOverlap::None) {
+        if (claimed[static_cast<std::size_t>(dof)]) continue;
+        claimed[static_cast<std::size_t>(dof)] = true;
+      }
+      patch_index_[static_cast<std::size_t>(dof)] = static_cast<int>(patch_dofs_.size()) - first;
+      patch_dofs_.push_back(dof);
+    }
+  }
+
+  // reset the scratch map for the next patch
+  for (auto i = static_cast<std::size_t>(first); i < patch_dofs_.size(); i++) {
+    patch_index_[static_cast<std::size_t>(patch_dofs_[i])] = -1;
+  }
+
+  auto n = static_cast<std::size_t>(patch_dofs_.size()) - static_cast<std::size_t>(first);
+  if (n > 0) {
+    patch_offsets_.push_back(static_cast<int>(patch_dofs_.size()));
+    factor_offsets_.push_back(factor_offsets_.back() + n * n);
+  }
+}
+
+void ElementSchwarzPreconditioner::BuildPatches()
+{
+  auto num_local_dofs = static_cast<std::size_t>(pfes_.GetVSize());
+  patch_index_.assign(num_local_dofs, -1);
+  constrained_.assign(num_local_dofs, false);
+
+  patch_offsets_  = {0};
+  factor_offsets_ = {0};
+  patch_dofs_.clear();
+
+  std::vector<bool> claimed(num_local_dofs, false);
+
+  if (overlap_ == SchwarzOverlap::VertexPatch) {
+    std::unique_ptr<mfem::Table> vertex_to_element(pfes_.GetParMesh()->GetVertexToElementTable());
+    for (int v = 0; v < vertex_to_element->Size(); v++) {
+      AddPatch(vertex_to_element->GetRow(v), vertex_to_element->RowSize(v), claimed);
+    }
+  } else {
+    for (int e = 0; e < pfes_.GetNE(); e++) {
+      AddPatch(&e, 1, claimed);
+    }
+  }
+
+  factors_.resize(factor_offsets_.back());
+  pivots_.resize(patch_dofs_.size());
+
+  std::size_t max_patch_size = 0;
+  for (int p = 0; p < NumPatches(); p++) {
+    max_patch_size = std::max(max_patch_size, static_cast<std::size_t>(patch_offsets_[p + 1] - patch_offsets_[p]));
+  }
+  patch_rhs_.resize(max_patch_size);
+}
+
+void ElementSchwarzPreconditioner::SetOperator(const mfem::Operator& op)
+{
+  SLIC_ERROR_ROOT_IF(op.Height() != height, "Operator size does not match the element preconditioner");
+  Refactor();
+}
+
+void ElementSchwarzPreconditioner::Refactor()
+{
+  const mfem::SparseMatrix& A = local_matrix_();
+  SLIC_ERROR_ROOT_IF(A.Height() != pfes_.GetVSize() || A.Width() != pfes_.GetVSize(),
+                     "Element matrices are incompatible with the element preconditioner's finite element space");
+
+  // essential true DOFs are mapped to every local copy of that DOF
+  std::fill(constrained_.begin(), constrained_.end(), false);
+  if (essential_tdofs_ && essential_tdofs_->Size() > 0) {
+    mfem::Vector marker_T(pfes_.GetTrueVSize());
+    marker_T = 0.0;
+    for (int tdof : *essential_tdofs_) {
+      marker_T[tdof] = 1.0;
+    }
+    pfes_.GetProlongationMatrix()->Mult(marker_T, r_L_);
+    for (std::size_t i = 0; i < constrained_.size(); i++) {
+      constrained_[i] = r_L_[static_cast<int>(i)] > 0.5;
+    }
+  }
+
+  const int*    row_ptr = A.GetI();
+  const int*    col_ind = A.GetJ();
+  const double* values  = A.GetData();
+
+  int num_singular = 0;
+  for (int p = 0; p < NumPatches(); p++) {
+    const int* dofs  = &patch_dofs_[static_cast<std::size_t>(patch_offsets_[p])];
+    const int  n     = patch_offsets_[p + 1] - patch_offsets_[p];
+    double*    block = &factors_[factor_offsets_[static_cast<std::size_t>(p)]];
+
+    std::fill(block, block + n * n, 0.0);
+    for (int a = 0; a < n; a++) {
+      patch_index_[static_cast<std::size_t>(dofs[a])] = a;
+    }
+
+    // extract the (column-major) dense block of the local matrix associated with this patch,
+    // replacing the rows and columns of constrained DOFs with the identity
+    for (int a = 0; a < n; a++) {
+      int row = dofs[a];
+      if (constrained_[static_cast<std::size_t>(row)]) {
+        block[a + a * n] = 1.0;
+        continue;
+      }
+      for (int k = row_ptr[row]; k < row_ptr[row + 1]; k++) {
+        int b = patch_index_[static_cast<std::size_t>(col_ind[k])];
+        if (b >= 0 && !constrained_[static_cast<std::size_t>(col_ind[k])]) {
+          block[a + b * n] += values[k];
+        }
+      }
+    }
+
+    for (int a = 0; a < n; a++) {
+      patch_index_[static_cast<std::size_t>(dofs[a])] = -1;
+    }
+
+    mfem::LUFactors lu(block, &pivots_[static_cast<std::size_t>(patch_offsets_[p])]);
+    num_singular += !lu.Factor(n);
+  }
+
+  SLIC_WARNING_IF(num_singular > 0,
+                  axom::fmt::format("{0} singular patch matrices found in ElementSchwarzPreconditioner", num_singular));
+  num_factorizations_++;
+}
+
+void ElementSchwarzPreconditioner::Mult(const mfem::Vector& r, mfem::Vector& z) const
+{
+  pfes_.GetProlongationMatrix()->Mult(r, r_L_);
+
+  z_L_ = 0.0;
+  for (int p = 0; p < NumPatches(); p++) {
+    const int* dofs = &patch_dofs_[static_cast<std::size_t>(patch_offsets_[p])];
+    const int  n    = patch_offsets_[p + 1] - patch_offsets_[p];
+
+    for (int a = 0; a < n; a++) {
+      patch_rhs_[static_cast<std::size_t>(a)] = r_L_[dofs[a]];
+    }
+
+    // LUFactors::Solve only reads the factors and pivots
+    mfem::LUFactors lu(const_cast<double*>(&factors_[factor_offsets_[static_cast<std::size_t>(p)]]),
+                       const_cast<int*>(&pivots_[static_cast<std::size_t>(patch_offsets_[p])]));
+    lu.Solve(n, 1, patch_rhs_.data());
+
+    for (int a = 0; a < n; a++) {
+      z_L_[dofs[a]] += patch_rhs_[static_cast<std::size_t>(a)];
+    }
+  }
+
+  if (overlap_ == SchwarzOverlap::None) {
+    // each DOF belongs to a single block, so only the owning processor's value is kept
+    pfes_.GetRestrictionMatrix()->Mult(z_L_, z);
+  } else {
+    // overlapping contributions (including those from neighboring processors) are summed
+    pfes_.GetProlongationMatrix()->MultTranspose(z_L_, z);
+  }
+}
+
+}  // namespace serac::mfem_ext
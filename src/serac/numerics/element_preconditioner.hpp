@@ -0,0 +1,141 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file element_preconditioner.hpp
+ *
+ * @brief Element-by-element block preconditioners built from processor-local element matrices
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief An additive Schwarz preconditioner whose subdomains are small patches of DOFs
+ * (element DOFs, or the DOFs of all elements around a vertex).
+ *
+ * The local patch matrices are extracted from the processor-local sparse matrix that is summed
+ * directly from the element gradients, so no parallel (global) matrix assembly is required.
+ * The patch layout and the storage for the dense LU factors are computed once, and the
+ * factors themselves are recomputed on every call to SetOperator. Reusing them across Newton
+ * iterations is controlled by PreconditionerReuseOptions, as for any other preconditioner.
+ * Applying the preconditioner requires only the nearest-neighbor communication of the prolongation
+ * operator, and no global reductions.
+ *
+ * With SchwarzOverlap::None, every DOF belongs to exactly one patch, which makes this an
+ * element-block Jacobi preconditioner.
+ */
+class ElementSchwarzPreconditioner : public mfem::Solver {
+public:
+  /**
+   * @brief Constructs the preconditioner and computes the patch layout
+   * @param[in] pfes The finite element space that the element matrices are defined on
+   * @param[in] local_matrix A callback returning the current processor-local sparse matrix
+   * @param[in] overlap The type of patches to use
+   * @param[in] essential_tdofs The (optional) essential true DOFs, treated as eliminated rows and columns
+   */
+  ElementSchwarzPreconditioner(mfem::ParFiniteElementSpace&               pfes,
+                               std::function<const mfem::SparseMatrix&()> local_matrix,
+                               SchwarzOverlap                             overlap         = SchwarzOverlap::None,
+                               const mfem::Array<int>*                    essential_tdofs = nullptr);
+
+  /**
+   * @brief Notifies the preconditioner that the operator has changed, refactoring the
+   * patch matrices from the current local matrix
+   * @param[in] op The operator being preconditioned (only its size is used)
+   * @note Implements mfem::Operator::SetOperator
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Applies the preconditioner, z = sum_p R_p^T A_p^{-1} R_p r
+   * @param[in] r The residual (true DOF) vector
+   * @param[out] z The preconditioned (true DOF) vector
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& r, mfem::Vector& z) const override;
+
+  /**
+   * @brief Forces the patch matrices to be refactored from the current local matrix
+   */
+  void Refactor();
+
+  /**
+   * @brief The number of patches on this processor
+   */
+  int NumPatches() const { return static_cast<int>(patch_offsets_.size()) - 1; }
+
+  /**
+   * @brief The number of times the patch matrices have been factored
+   */
+  int NumFactorizations() const { return num_factorizations_; }
+
+private:
+  /**
+   * @brief Computes the DOFs belonging to each patch
+   */
+  void BuildPatches();
+
+  /**
+   * @brief Appends a patch made up of the unique DOFs of the given elements
+   * @param[in] elements The element ids that make up the patch
+   * @param[in] num_elements The number of elements in the patch
+   * @param[inout] claimed Marks DOFs that already belong to a patch, for the non-overlapping case
+   */
+  void AddPatch(const int* elements, int num_elements, std::vector<bool>& claimed);
+
+  /// @brief The finite element space the element matrices are defined on
+  mfem::ParFiniteElementSpace& pfes_;
+
+  /// @brief Callback that returns the processor-local matrix summed from the element gradients
+  std::function<const mfem::SparseMatrix&()> local_matrix_;
+
+  /// @brief The type of patches to use
+  SchwarzOverlap overlap_;
+
+  /// @brief The (optional) list of essential true DOFs
+  const mfem::Array<int>* essential_tdofs_;
+
+  /// @brief The number of times the patch matrices have been factored
+  int num_factorizations_ = 0;
+
+  /// @brief patch p consists of the local DOFs patch_dofs_[patch_offsets_[p]] ... patch_dofs_[patch_offsets_[p+1] - 1]
+  std::vector<int> patch_offsets_;
+
+  /// @brief The local DOFs of each patch, concatenated
+  std::vector<int> patch_dofs_;
+
+  /// @brief The offset of each patch's dense (column-major) LU factors in factors_
+  std::vector<std::size_t> factor_offsets_;
+
+  /// @brief The dense LU factors of each patch matrix, concatenated
+  std::vector<double> factors_;
+
+  /// @brief The LU pivots of each patch, using the same offsets as patch_dofs_
+  std::vector<int> pivots_;
+
+  /// @brief Scratch map from a local DOF to its index in the current patch (-1 if not in the patch)
+  std::vector<int> patch_index_;
+
+  /// @brief Whether each local DOF is constrained by an essential boundary condition
+  std::vector<bool> constrained_;
+
+  /// @brief Processor-local residual and correction vectors
+  mutable mfem::Vector r_L_, z_L_;
+
+  /// @brief Scratch storage for the patch-local right hand side
+  mutable std::vector<double> patch_rhs_;
+};
+
+}  // namespace serac::mfem_ext
@@ -8,9 +8,55 @@
 
 #include "serac/infrastructure/logger.hpp"
 #include "serac/infrastructure/terminator.hpp"
+#include "serac/numerics/element_preconditioner.hpp"
+#include "serac/numerics/krylov_solvers.hpp"
+#include "serac/numerics/mixed_precision.hpp"
+#include "serac/numerics/newton_solver.hpp"
+#include "serac/numerics/recycling_solver.hpp"
 
 namespace serac::mfem_ext {
 
+namespace {
+
+/**
+ * @brief Forwards the applications of a preconditioner that has already been built, but not its operator updates
+ */
+class FixedPreconditioner : public mfem::Solver {
+public:
+  /**
+   * @brief Constructs the wrapper
+   * @param[in] prec The preconditioner
+   */
+  explicit FixedPreconditioner(mfem::Solver& prec) : mfem::Solver(prec.Height(), prec.Width()), prec_(prec) {}
+
+  /// @brief Ignores the operator
+  void SetOperator(const mfem::Operator&) override {}
+
+  /**
+   * @brief Applies the preconditioner
+   * @param[in] r The input vector
+   * @param[out] z The preconditioned vector
+   */
+  void Mult(const mfem::Vector& r, mfem::Vector& z) const override { prec_.Mult(r, z); }
+
+private:
+  /// @brief The preconditioner
+  mfem::Solver& prec_;
+};
+
+/**
+ * @brief Appends the CSR row offsets and column indices of a sparse matrix to a sparsity pattern
+ * @param[in] A The sparse matrix
+ * @param[inout] pattern The sparsity pattern
+ */
+void appendPattern(const mfem::SparseMatrix& A, std::vector<int>& pattern)
+{
+  pattern.insert(pattern.end(), A.GetI(), A.GetI() + A.Height() + 1);
+  pattern.insert(pattern.end(), A.GetJ(), A.GetJ() + A.NumNonZeroElems());
+}
+
+}  // namespace
+
 EquationSolver::EquationSolver(MPI_Comm comm, const LinearSolverOptions& lin_options,
                                const std::optional<NonlinearSolverOptions>& nonlin_options)
 {
@@ -25,7 +71,7 @@ EquationSolver::EquationSolver(MPI_Comm comm, const LinearSolverOptions& lin_opt
   }
   // If it's a direct solver (currently SuperLU only)
   else if (auto direct_options = std::get_if<DirectSolverOptions>(&lin_options)) {
-    auto direct_solver = std::make_unique<mfem::SuperLUSolver>(comm);
+    auto direct_solver = std::make_unique<SuperLUSolver>(comm, direct_options->reuse_symbolic_factorization);
     direct_solver->SetColumnPermutation(mfem::superlu::PARMETIS);
     if (direct_options->print_level == 0) {
       direct_solver->SetPrintStatistics(false);
@@ -35,6 +81,13 @@ EquationSolver::EquationSolver(MPI_Comm comm, const LinearSolverOptions& lin_opt
 
   if (nonlin_options) {
     nonlin_solver_ = BuildNewtonSolver(comm, *nonlin_options);
+    SLIC_ERROR_ROOT_IF(nonlin_options->forcing_term != NewtonForcingTerm::Fixed &&
+                           !std::holds_alternative<std::unique_ptr<mfem::IterativeSolver>>(lin_solver_),
+                       "Adaptive Newton forcing terms require an iterative linear solver");
+    if (auto newton_solver = dynamic_cast<NewtonSolver*>(nonlin_solver_.get());
+        newton_solver && nonlin_options->forcing_term != NewtonForcingTerm::Fixed) {
+      newton_solver->SetLinearRelTol(std::get<IterativeSolverOptions>(lin_options).rel_tol);
+    }
   }
 }
 
@@ -111,11 +164,34 @@ std::unique_ptr<mfem::IterativeSolver> EquationSolver::BuildIterativeLinearSolve
     case LinearSolver::MINRES:
       iter_lin_solver = std::make_unique<mfem::MINRESSolver>(comm);
       break;
+    case LinearSolver::PipelinedCG:
+      iter_lin_solver = std::make_unique<PipelinedCGSolver>(comm);
+      break;
+    case LinearSolver::PipelinedGMRES:
+      iter_lin_solver = std::make_unique<PipelinedGMRESSolver>(comm);
+      break;
+    case LinearSolver::SStepCG:
+      iter_lin_solver = std::make_unique<SStepCGSolver>(comm, lin_options.s_step);
+      break;
     default:
       SLIC_ERROR_ROOT("Linear solver type not recognized.");
       exitGracefully(true);
   }
 
+  // Augment the Krylov solver with the subspace spanned by the previous solutions' corrections
+  if (lin_options.recycle_dim > 0) {
+    const bool symmetric =
+        lin_options.lin_solver != LinearSolver::GMRES && lin_options.lin_solver != LinearSolver::PipelinedGMRES;
+    iter_lin_solver =
+        std::make_unique<RecyclingKrylovSolver>(comm, std::move(iter_lin_solver), lin_options.recycle_dim, symmetric);
+  }
+
+  // Compute the corrections of a double precision iterative refinement in single precision
+  if (lin_options.mixed_precision) {
+    iter_lin_solver =
+        std::make_unique<MixedPrecisionRefinementSolver>(comm, std::move(iter_lin_solver), lin_options.inner_rel_tol);
+  }
+
   iter_lin_solver->SetRelTol(lin_options.rel_tol);
   iter_lin_solver->SetAbsTol(lin_options.abs_tol);
   iter_lin_solver->SetMaxIter(lin_options.max_iter);
@@ -125,8 +201,14 @@ std::unique_ptr<mfem::IterativeSolver> EquationSolver::BuildIterativeLinearSolve
   if (lin_options.prec) {
     const auto prec_ptr = &lin_options.prec.value();
     if (auto amg_options = std::get_if<HypreBoomerAMGPrec>(prec_ptr)) {
-      auto prec_amg = std::make_unique<mfem::HypreBoomerAMG>();
-      auto par_fes  = amg_options->pfes;
+      // The hierarchy can only be frozen if the AMG object allows its fine-level matrix to be swapped
+      std::unique_ptr<mfem::HypreBoomerAMG> prec_amg;
+      if (lin_options.prec_reuse.freeze_amg_hierarchy) {
+        prec_amg = std::make_unique<FrozenHierarchyAMG>();
+      } else {
+        prec_amg = std::make_unique<mfem::HypreBoomerAMG>();
+      }
+      auto par_fes = amg_options->pfes;
       if (par_fes != nullptr) {
         SLIC_WARNING_ROOT_IF(par_fes->GetOrdering() == mfem::Ordering::byNODES,
                              "Attempting to use BoomerAMG with nodal ordering on an elasticity problem.");
@@ -148,6 +230,22 @@ std::unique_ptr<mfem::IterativeSolver> EquationSolver::BuildIterativeLinearSolve
 #endif
     } else if (auto ilu_options = std::get_if<BlockILUPrec>(prec_ptr)) {
       prec_ = std::make_unique<mfem::BlockILU>(ilu_options->block_size);
+    } else if (auto element_options = std::get_if<ElementSchwarzPrec>(prec_ptr)) {
+      SLIC_ERROR_ROOT_IF(!element_options->pfes || !element_options->local_matrix,
+                         "Element preconditioners must be configured by a physics module that provides element "
+                         "matrices, see AugmentElementPreconditioner");
+      prec_ = std::make_unique<ElementSchwarzPreconditioner>(*element_options->pfes, element_options->local_matrix,
+                                                             element_options->overlap,
+                                                             element_options->essential_tdofs);
+    }
+
+    // Only pay for the reuse bookkeeping if the preconditioner isn't rebuilt on every operator update
+    const auto& reuse = lin_options.prec_reuse;
+    if (reuse.rebuild_interval != 1 || reuse.max_linear_iterations > 0 || reuse.rebuild_on_new_step ||
+        reuse.freeze_amg_hierarchy) {
+      auto reusable_prec = std::make_unique<ReusablePreconditioner>(std::move(prec_), *iter_lin_solver, reuse);
+      prec_reuse_        = reusable_prec.get();
+      prec_              = std::move(reusable_prec);
     }
     iter_lin_solver->SetPreconditioner(*prec_);
   }
@@ -160,7 +258,19 @@ std::unique_ptr<mfem::NewtonSolver> EquationSolver::BuildNewtonSolver(MPI_Comm
   std::unique_ptr<mfem::NewtonSolver> newton_solver;
 
   if (nonlin_options.nonlin_solver == NonlinearSolver::MFEMNewton) {
-    newton_solver = std::make_unique<mfem::NewtonSolver>(comm);
+    newton_solver = std::make_unique<NewtonSolver>(comm, nonlin_options);
+
+    // Eisenstat-Walker forcing terms, which loosen the linear tolerance while far from the solution
+    if (nonlin_options.forcing_term != NewtonForcingTerm::Fixed) {
+      const int choice = (nonlin_options.forcing_term == NewtonForcingTerm::EisenstatWalker1) ? 1 : 2;
+      newton_solver->SetAdaptiveLinRtol(choice, nonlin_options.initial_forcing_term, nonlin_options.max_forcing_term);
+    }
+  } else if (nonlin_options.nonlin_solver == NonlinearSolver::LBFGS ||
+             nonlin_options.nonlin_solver == NonlinearSolver::Broyden ||
+             nonlin_options.nonlin_solver == NonlinearSolver::Anderson) {
+    newton_solver = std::make_unique<QuasiNewtonSolver>(comm, nonlin_options);
+    SLIC_WARNING_ROOT_IF(nonlin_options.forcing_term != NewtonForcingTerm::Fixed,
+                         "Adaptive forcing terms are not used by the quasi-Newton solvers");
   }
   // KINSOL
   else {
@@ -171,6 +281,10 @@ std::unique_ptr<mfem::NewtonSolver> EquationSolver::BuildNewtonSolver(MPI_Comm
 #else
     SLIC_ERROR_ROOT("KINSOL was not enabled when MFEM was built");
 #endif
+    SLIC_WARNING_ROOT_IF(nonlin_options.forcing_term != NewtonForcingTerm::Fixed,
+                         "Adaptive forcing terms are only supported by the MFEMNewton nonlinear solver");
+    SLIC_WARNING_ROOT_IF(nonlin_options.line_search != NewtonLineSearch::None,
+                         "Use KINLineSearch for a line search with KINSOL");
   }
 
   newton_solver->SetRelTol(nonlin_options.rel_tol);
@@ -183,12 +297,7 @@ std::unique_ptr<mfem::NewtonSolver> EquationSolver::BuildNewtonSolver(MPI_Comm
 void EquationSolver::SetOperator(const mfem::Operator& op)
 {
   if (nonlin_solver_) {
-    if (std::holds_alternative<std::unique_ptr<mfem::SuperLUSolver>>(lin_solver_)) {
-      superlu_wrapper_ = std::make_unique<SuperLUNonlinearOperatorWrapper>(op);
-      nonlin_solver_->SetOperator(*superlu_wrapper_);
-    } else {
-      nonlin_solver_->SetOperator(op);
-    }
+    nonlin_solver_->SetOperator(op);
     // Now that the nonlinear solver knows about the operator, we can set its linear solver
     if (!nonlin_solver_set_solver_called_) {
       nonlin_solver_->SetSolver(LinearSolver());
@@ -201,16 +310,26 @@ void EquationSolver::SetOperator(const mfem::Operator& op)
   width  = op.Width();
 }
 
-void EquationSolver::SetOperator(const mfem::HypreParMatrix& matrix)
+bool EquationSolver::SetLinearOperator(const mfem::Operator& op, const mfem::Operator& prec_op)
 {
-  if (std::holds_alternative<std::unique_ptr<mfem::SuperLUSolver>>(lin_solver_)) {
-    superlu_mat_ = matrix;
-    SetOperator(*superlu_mat_);
+  auto iter_lin_solver = std::get_if<std::unique_ptr<mfem::IterativeSolver>>(&lin_solver_);
+  if (!iter_lin_solver) {
+    return false;
   }
-  // Otherwise just upcast and call as usual
-  else {
-    SetOperator(static_cast<const mfem::Operator&>(matrix));
+
+  if (prec_) {
+    prec_->SetOperator(prec_op);
+
+    // IterativeSolver::SetOperator passes its operator on to the preconditioner, so the preconditioner is
+    // swapped for one that ignores it while the operator is set
+    FixedPreconditioner fixed_prec(*prec_);
+    (*iter_lin_solver)->SetPreconditioner(fixed_prec);
+    (*iter_lin_solver)->SetOperator(op);
+    (*iter_lin_solver)->SetPreconditioner(*prec_);
+  } else {
+    (*iter_lin_solver)->SetOperator(op);
   }
+  return true;
 }
 
 void EquationSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
@@ -220,16 +339,70 @@ void EquationSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
   } else {
     std::visit([&b, &x](auto&& solver) { solver->Mult(b, x); }, lin_solver_);
   }
+
+  // Any subsequent operator updates belong to the next step
+  if (prec_reuse_) {
+    prec_reuse_->NewStep();
+  }
 }
 
-mfem::Operator& EquationSolver::SuperLUNonlinearOperatorWrapper::GetGradient(const mfem::Vector& x) const
+bool EquationSolver::PredictWithLastJacobian(const mfem::Vector& b, mfem::Vector& x) const
 {
-  mfem::Operator&       grad      = oper_.GetGradient(x);
-  mfem::HypreParMatrix* matr_grad = dynamic_cast<mfem::HypreParMatrix*>(&grad);
+  auto newton_solver = dynamic_cast<const NewtonSolver*>(nonlin_solver_.get());
+  return newton_solver && newton_solver->LaggedStep(b, x);
+}
 
-  SLIC_ERROR_ROOT_IF(matr_grad == nullptr, "Nonlinear operator gradient must be a HypreParMatrix");
-  superlu_grad_mat_.emplace(*matr_grad);
-  return *superlu_grad_mat_;
+SuperLUSolver::SuperLUSolver(MPI_Comm comm, bool reuse_symbolic_factorization)
+    : mfem::SuperLUSolver(comm), reuse_symbolic_factorization_(reuse_symbolic_factorization)
+{
+}
+
+void SuperLUSolver::SetOperator(const mfem::Operator& op)
+{
+  auto matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+  if (!matrix) {
+    SLIC_ERROR_ROOT_IF(!dynamic_cast<const mfem::SuperLURowLocMatrix*>(&op),
+                       "SuperLU operators must be a HypreParMatrix or a SuperLURowLocMatrix");
+    mfem::SuperLUSolver::SetOperator(op);
+    SetFact(mfem::superlu::DOFACT);
+    factored_rows_ = -1;
+    num_symbolic_factorizations_++;
+    return;
+  }
+
+  // The sparsity pattern is identified by the CSR structure of both blocks and the off-processor columns
+  // on every rank, as a different pattern with the same number of entries would reuse a wrong factorization
+  std::vector<int>          pattern;
+  std::vector<HYPRE_BigInt> col_map;
+
+  int same_pattern = reuse_symbolic_factorization_ && (factored_rows_ == matrix->GetGlobalNumRows());
+  if (reuse_symbolic_factorization_) {
+    mfem::SparseMatrix diag, offd;
+    HYPRE_BigInt*      offd_col_map;
+    matrix->GetDiag(diag);
+    matrix->GetOffd(offd, offd_col_map);
+    appendPattern(diag, pattern);
+    appendPattern(offd, pattern);
+    col_map.assign(offd_col_map, offd_col_map + offd.Width());
+    same_pattern = same_pattern && (pattern == factored_pattern_) && (col_map == factored_col_map_);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &same_pattern, 1, MPI_INT, MPI_MIN, matrix->GetComm());
+
+  // SuperLU requires its own distributed row format, but only one converted copy is kept
+  superlu_mat_.reset();
+  superlu_mat_.emplace(*matrix);
+  mfem::SuperLUSolver::SetOperator(*superlu_mat_);
+
+  if (same_pattern) {
+    // Keep the permutations and symbolic factorization, and only refactor numerically
+    SetFact(mfem::superlu::SamePattern_SameRowPerm);
+  } else {
+    SetFact(mfem::superlu::DOFACT);
+    factored_rows_    = matrix->GetGlobalNumRows();
+    factored_pattern_ = std::move(pattern);
+    factored_col_map_ = std::move(col_map);
+    num_symbolic_factorizations_++;
+  }
 }
 
 void EquationSolver::DefineInputFileSchema(axom::inlet::Container& container)
@@ -254,12 +427,46 @@ void EquationSolver::DefineInputFileSchema(axom::inlet::Container& container)
   iterative_container.addDouble("abs_tol", "Absolute tolerance for the linear solve.").defaultValue(1.0e-8);
   iterative_container.addInt("max_iter", "Maximum iterations for the linear solve.").defaultValue(5000);
   iterative_container.addInt("print_level", "Linear print level.").defaultValue(0);
-  iterative_container.addString("solver_type", "Solver type (gmres|minres|cg).").defaultValue("gmres");
-  iterative_container.addString("prec_type", "Preconditioner type (JacobiSmoother|L1JacobiSmoother|AMG|BlockILU).")
+  iterative_container
+      .addString("solver_type", "Solver type (gmres|minres|cg|pipelinedcg|pipelinedgmres|sstepcg).")
+      .defaultValue("gmres");
+  iterative_container.addInt("s_step", "Krylov vectors per global reduction of the s-step solvers.").defaultValue(4);
+  iterative_container
+      .addString("prec_type",
+                 "Preconditioner type "
+                 "(JacobiSmoother|L1JacobiSmoother|AMG|BlockILU|ElementJacobi|ElementSchwarz|VertexPatchSchwarz).")
       .defaultValue("JacobiSmoother");
+  iterative_container
+      .addInt("prec_rebuild_interval",
+              "Number of operator updates (e.g. Newton iterations) between preconditioner rebuilds, 0 to disable.")
+      .defaultValue(1);
+  iterative_container
+      .addInt("prec_rebuild_iterations",
+              "Rebuild the preconditioner when a linear solve takes more than this many iterations, 0 to disable.")
+      .defaultValue(0);
+  iterative_container.addBool("prec_rebuild_on_new_step", "Rebuild the preconditioner at the start of each solve.")
+      .defaultValue(false);
+  iterative_container
+      .addBool("prec_freeze_amg_hierarchy",
+               "Keep the AMG coarse hierarchy when reusing the preconditioner, refreshing only the fine-level matrix.")
+      .defaultValue(false);
+  iterative_container
+      .addInt("recycle_dim", "Dimension of the subspace recycled from previous solves, 0 to disable recycling.")
+      .defaultValue(0);
+  iterative_container
+      .addBool("mixed_precision",
+               "Refine the solution in double precision with corrections computed from a single precision operator.")
+      .defaultValue(false);
+  iterative_container
+      .addDouble("inner_rel_tol", "Relative tolerance of the single precision correction solves of mixed_precision.")
+      .defaultValue(1.0e-4);
 
   auto& direct_container = linear_container.addStruct("direct_options", "Direct solver parameters");
   direct_container.addInt("print_level", "Linear print level.").defaultValue(0);
+  direct_container
+      .addBool("reuse_symbolic_factorization",
+               "Reuse the permutations and symbolic factorization when the sparsity pattern is unchanged.")
+      .defaultValue(true);
 
   // Only needed for nonlinear problems
   auto& nonlinear_container = container.addStruct("nonlinear", "Newton Equation Solver Parameters").required(false);
@@ -267,8 +474,40 @@ void EquationSolver::DefineInputFileSchema(axom::inlet::Container& container)
   nonlinear_container.addDouble("abs_tol", "Absolute tolerance for the Newton solve.").defaultValue(1.0e-4);
   nonlinear_container.addInt("max_iter", "Maximum iterations for the Newton solve.").defaultValue(500);
   nonlinear_container.addInt("print_level", "Nonlinear print level.").defaultValue(0);
-  nonlinear_container.addString("solver_type", "Solver type (MFEMNewton|KINFullStep|KINLineSearch)")
+  nonlinear_container
+      .addString("solver_type", "Solver type (MFEMNewton|KINFullStep|KINLineSearch|LBFGS|Broyden|Anderson)")
       .defaultValue("MFEMNewton");
+  nonlinear_container
+      .addInt("max_jacobian_age",
+              "Maximum number of Newton iterations a Jacobian is reused for, 1 for full Newton, 0 for no limit. "
+              "Defaults to 1 for MFEMNewton and 0 for the quasi-Newton solvers.");
+  nonlinear_container
+      .addDouble("jacobian_refresh_rate",
+                 "Refresh the Jacobian when an iteration reduces the residual norm by less than this factor.")
+      .defaultValue(0.5);
+  nonlinear_container
+      .addBool("reuse_jacobian_across_solves", "Whether the last Jacobian of a solve may be reused by the next solve.")
+      .defaultValue(false);
+  nonlinear_container
+      .addString("forcing_term", "Linear solver tolerance selection (Fixed|EisenstatWalker1|EisenstatWalker2)")
+      .defaultValue("Fixed");
+  nonlinear_container
+      .addDouble("initial_forcing_term", "Linear solver relative tolerance of the first adaptive Newton iteration.")
+      .defaultValue(0.5);
+  nonlinear_container.addDouble("max_forcing_term", "Upper bound on the adaptive linear solver relative tolerance.")
+      .defaultValue(0.9);
+  nonlinear_container.addString("line_search", "Newton line search (None|Backtracking|CriticalPoint)")
+      .defaultValue("None");
+  nonlinear_container
+      .addInt("max_line_search_iterations", "Maximum number of residual evaluations in a single line search.")
+      .defaultValue(10);
+  nonlinear_container.addDouble("armijo_constant", "Sufficient decrease constant of the backtracking line search.")
+      .defaultValue(1.0e-4);
+  nonlinear_container.addDouble("backtracking_factor", "Step length reduction factor of the backtracking line search.")
+      .defaultValue(0.5);
+  nonlinear_container
+      .addInt("quasi_newton_memory", "Number of previous iterates used by the LBFGS, Broyden and Anderson solvers.")
+      .defaultValue(5);
 }
 
 }  // namespace serac::mfem_ext
@@ -295,6 +534,12 @@ serac::LinearSolverOptions FromInlet<serac::LinearSolverOptions>::operator()(con
       iter_options.lin_solver = serac::LinearSolver::MINRES;
     } else if (solver_type == "cg") {
       iter_options.lin_solver = serac::LinearSolver::CG;
+    } else if (solver_type == "pipelinedcg") {
+      iter_options.lin_solver = serac::LinearSolver::PipelinedCG;
+    } else if (solver_type == "pipelinedgmres") {
+      iter_options.lin_solver = serac::LinearSolver::PipelinedGMRES;
+    } else if (solver_type == "sstepcg") {
+      iter_options.lin_solver = serac::LinearSolver::SStepCG;
     } else {
       std::string msg = axom::fmt::format("Unknown Linear solver type given: {0}", solver_type);
       SLIC_ERROR_ROOT(msg);
@@ -312,15 +557,30 @@ serac::LinearSolverOptions FromInlet<serac::LinearSolverOptions>::operator()(con
       iter_options.prec = serac::AMGXPrec{.smoother = serac::AMGXSolver::JACOBI_L1};
     } else if (prec_type == "BlockILU") {
       iter_options.prec = serac::BlockILUPrec{};
+    } else if (prec_type == "ElementJacobi") {
+      iter_options.prec = serac::ElementSchwarzPrec{.overlap = serac::SchwarzOverlap::None};
+    } else if (prec_type == "ElementSchwarz") {
+      iter_options.prec = serac::ElementSchwarzPrec{.overlap = serac::SchwarzOverlap::Element};
+    } else if (prec_type == "VertexPatchSchwarz") {
+      iter_options.prec = serac::ElementSchwarzPrec{.overlap = serac::SchwarzOverlap::VertexPatch};
     } else {
       std::string msg = axom::fmt::format("Unknown preconditioner type given: {0}", prec_type);
       SLIC_ERROR_ROOT(msg);
     }
-    options = iter_options;
+    iter_options.prec_reuse.rebuild_interval      = config["prec_rebuild_interval"];
+    iter_options.prec_reuse.max_linear_iterations = config["prec_rebuild_iterations"];
+    iter_options.prec_reuse.rebuild_on_new_step   = config["prec_rebuild_on_new_step"];
+    iter_options.prec_reuse.freeze_amg_hierarchy  = config["prec_freeze_amg_hierarchy"];
+    iter_options.recycle_dim                      = config["recycle_dim"];
+    iter_options.s_step                           = config["s_step"];
+    iter_options.mixed_precision                  = config["mixed_precision"];
+    iter_options.inner_rel_tol                    = config["inner_rel_tol"];
+    options                                       = iter_options;
   } else if (type == "direct") {
     serac::DirectSolverOptions direct_options;
-    direct_options.print_level = base["direct_options/print_level"];
-    options                    = direct_options;
+    direct_options.print_level                  = base["direct_options/print_level"];
+    direct_options.reuse_symbolic_factorization = base["direct_options/reuse_symbolic_factorization"];
+    options                                     = direct_options;
   }
   return options;
 }
@@ -339,9 +599,46 @@ serac::NonlinearSolverOptions FromInlet<serac::NonlinearSolverOptions>::operator
     options.nonlin_solver = serac::NonlinearSolver::KINFullStep;
   } else if (solver_type == "KINLineSearch") {
     options.nonlin_solver = serac::NonlinearSolver::KINBacktrackingLineSearch;
+  } else if (solver_type == "LBFGS") {
+    options.nonlin_solver = serac::NonlinearSolver::LBFGS;
+  } else if (solver_type == "Broyden") {
+    options.nonlin_solver = serac::NonlinearSolver::Broyden;
+  } else if (solver_type == "Anderson") {
+    options.nonlin_solver = serac::NonlinearSolver::Anderson;
   } else {
     SLIC_ERROR_ROOT(axom::fmt::format("Unknown nonlinear solver type given: {0}", solver_type));
   }
+  if (base.contains("max_jacobian_age")) {
+    options.max_jacobian_age = base["max_jacobian_age"].get<int>();
+  }
+  options.jacobian_refresh_rate        = base["jacobian_refresh_rate"];
+  options.reuse_jacobian_across_solves = base["reuse_jacobian_across_solves"];
+  const std::string forcing_term       = base["forcing_term"];
+  if (forcing_term == "Fixed") {
+    options.forcing_term = serac::NewtonForcingTerm::Fixed;
+  } else if (forcing_term == "EisenstatWalker1") {
+    options.forcing_term = serac::NewtonForcingTerm::EisenstatWalker1;
+  } else if (forcing_term == "EisenstatWalker2") {
+    options.forcing_term = serac::NewtonForcingTerm::EisenstatWalker2;
+  } else {
+    SLIC_ERROR_ROOT(axom::fmt::format("Unknown Newton forcing term given: {0}", forcing_term));
+  }
+  options.initial_forcing_term = base["initial_forcing_term"];
+  options.max_forcing_term     = base["max_forcing_term"];
+  const std::string line_search = base["line_search"];
+  if (line_search == "None") {
+    options.line_search = serac::NewtonLineSearch::None;
+  } else if (line_search == "Backtracking") {
+    options.line_search = serac::NewtonLineSearch::Backtracking;
+  } else if (line_search == "CriticalPoint") {
+    options.line_search = serac::NewtonLineSearch::CriticalPoint;
+  } else {
+    SLIC_ERROR_ROOT(axom::fmt::format("Unknown Newton line search given: {0}", line_search));
+  }
+  options.max_line_search_iterations = base["max_line_search_iterations"];
+  options.armijo_constant            = base["armijo_constant"];
+  options.backtracking_factor        = base["backtracking_factor"];
+  options.quasi_newton_memory        = base["quasi_newton_memory"];
   return options;
 }
 
@@ -15,14 +15,68 @@
 #include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include "mfem.hpp"
 
 #include "serac/infrastructure/input.hpp"
 #include "serac/numerics/solver_config.hpp"
+#include "serac/numerics/preconditioner_reuse.hpp"
 
 namespace serac::mfem_ext {
 
+/**
+ * @brief A SuperLU direct solver that accepts HypreParMatrix operators, and only refactors numerically
+ * when the sparsity pattern of the operator is unchanged
+ *
+ * The column permutation, row permutation and symbolic factorization of the first operator are reused
+ * (SuperLU's SamePattern_SameRowPerm mode) for subsequent operators with the same sparsity pattern on every
+ * rank, such as the Jacobians of a serac::Functional. The patterns are compared exactly, by the CSR structure
+ * of the diagonal and off-diagonal blocks and the global indices of the off-processor columns.
+ */
+class SuperLUSolver : public mfem::SuperLUSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] reuse_symbolic_factorization Whether to reuse the symbolic factorization for unchanged sparsity patterns
+   */
+  SuperLUSolver(MPI_Comm comm, bool reuse_symbolic_factorization = true);
+
+  /**
+   * @brief Sets the operator to factor
+   * @param[in] op The operator, either a HypreParMatrix (which is converted to SuperLU's distributed format)
+   * or a SuperLURowLocMatrix (whose sparsity pattern is assumed to have changed)
+   * @note Implements mfem::Operator::SetOperator
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief The number of full (symbolic and numeric) factorizations so far
+   */
+  int NumSymbolicFactorizations() const { return num_symbolic_factorizations_; }
+
+private:
+  /// @brief Whether the symbolic factorization is reused for unchanged sparsity patterns
+  bool reuse_symbolic_factorization_;
+
+  /// @brief The operator in SuperLU's distributed format, when converted from a HypreParMatrix
+  std::optional<mfem::SuperLURowLocMatrix> superlu_mat_;
+
+  /// @brief The global number of rows of the last factored HypreParMatrix, or -1 if there is none
+  HYPRE_BigInt factored_rows_ = -1;
+
+  /// @brief The row offsets and column indices of the diagonal and off-diagonal blocks of the last factored
+  /// HypreParMatrix on this rank
+  std::vector<int> factored_pattern_;
+
+  /// @brief The global indices of the off-processor columns of the last factored HypreParMatrix on this rank
+  std::vector<HYPRE_BigInt> factored_col_map_;
+
+  /// @brief The number of full (symbolic and numeric) factorizations
+  int num_symbolic_factorizations_ = 0;
+};
+
 /**
  * @brief Wraps a (currently iterative) system solver and handles the configuration of linear
  * or nonlinear solvers.  This class solves a generic global system of (possibly) nonlinear algebraic equations.
@@ -50,12 +104,14 @@ public:
   void SetOperator(const mfem::Operator& op) override;
 
   /**
-   * @brief An overload for "intercepting" HypreParMatrices
-   * such that they can be converted to a SuperLURowLocMatrix
-   * when running in SuperLU mode
-   * @param[in] matrix The operator (system matrix) to use, "A" in Ax = b
+   * Updates the linear solver with an operator that is only applied, e.g. a matrix-free transposed Jacobian,
+   * and an assembled operator to build the preconditioner from instead
+   * @param[in] op The operator of the linear solves
+   * @param[in] prec_op The operator passed to the preconditioner, which should approximate @a op
+   * @return Whether the operators were set, which requires an iterative linear solver, as direct solvers need
+   * @a op assembled
    */
-  void SetOperator(const mfem::HypreParMatrix& matrix);
+  bool SetLinearOperator(const mfem::Operator& op, const mfem::Operator& prec_op);
 
   /**
    * Solves the system
@@ -65,6 +121,15 @@ public:
    */
   void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
 
+  /**
+   * Improves the initial guess of the next nonlinear solve with one Newton step using the most recently
+   * evaluated Jacobian, so the existing preconditioner or factorization is reused (a tangent predictor)
+   * @param[in] b RHS of the system of equations
+   * @param[inout] x The initial guess, overwritten with the predicted solution
+   * @return Whether the step was taken, which requires a previous solve with the MFEMNewton or quasi-Newton solvers
+   */
+  bool PredictWithLastJacobian(const mfem::Vector& b, mfem::Vector& x) const;
+
   /**
    * Returns the underlying solver object
    * @return A non-owning reference to the underlying nonlinear solver
@@ -115,55 +180,16 @@ private:
   static std::unique_ptr<mfem::NewtonSolver> BuildNewtonSolver(MPI_Comm                      comm,
                                                                const NonlinearSolverOptions& nonlin_options);
 
-  /**
-   * @brief A wrapper class for combining a nonlinear solver with a SuperLU direct solver
-   */
-  class SuperLUNonlinearOperatorWrapper : public mfem::Operator {
-  public:
-    /**
-     * @brief Constructs a wrapper over an mfem::Operator
-     * @param[in] oper The operator to wrap
-     */
-    SuperLUNonlinearOperatorWrapper(const mfem::Operator& oper) : oper_(oper)
-    {
-      height = oper_.Height();
-      width  = oper_.Width();
-    }
-    /**
-     * @brief Applies the operator
-     * @param[in] b The input vector
-     * @param[out] x The output vector
-     * @note Implements mfem::Operator::Mult, forwards directly to underlying operator
-     */
-    void Mult(const mfem::Vector& b, mfem::Vector& x) const override { oper_.Mult(b, x); }
-
-    /**
-     * @brief Obtains the gradient of the underlying operator
-     * as a SuperLU matrix
-     * @param[in] x The point at which the gradient should be evaluated
-     * @return A non-owning reference to an mfem::SuperLURowLocMatrix (upcasts
-     * to match interface)
-     * @note Implements mfem::Operator::GetGradient
-     */
-    mfem::Operator& GetGradient(const mfem::Vector& x) const override;
-
-  private:
-    /**
-     * @brief The underlying operator
-     */
-    const mfem::Operator& oper_;
-
-    /**
-     * @brief The owner of the SuperLU matrix for the gradient, stored
-     * as a member variable for lifetime purposes
-     */
-    mutable std::optional<mfem::SuperLURowLocMatrix> superlu_grad_mat_;
-  };
   /**
    * @brief The preconditioner (used for an iterative solver only)
    */
   std::unique_ptr<mfem::Solver> prec_;
 
+  /**
+   * @brief A non-owning pointer to the preconditioner if it is wrapped for reuse across operator updates
+   */
+  ReusablePreconditioner* prec_reuse_ = nullptr;
+
   /**
    * @brief The linear solver object, either custom, direct (SuperLU), or iterative
    */
@@ -180,16 +206,6 @@ private:
    * before SetSolver
    */
   bool nonlin_solver_set_solver_called_ = false;
-
-  /**
-   * @brief The operator (system matrix) used with a SuperLU solver
-   */
-  std::optional<mfem::SuperLURowLocMatrix> superlu_mat_;
-
-  /**
-   * @brief A wrapper class that allows a direct solver to be used underneath a Newton-Raphson solver
-   */
-  std::unique_ptr<SuperLUNonlinearOperatorWrapper> superlu_wrapper_;
 };
 
 /**
@@ -215,6 +231,33 @@ inline LinearSolverOptions AugmentAMGForElasticity(const LinearSolverOptions&
   return augmented_options;
 }
 
+/**
+ * @brief A helper method intended to be called by physics modules to provide the element matrices
+ * used by an element-based (ElementSchwarzPrec) preconditioner
+ * @param[in] init_options The user-provided solver parameters to possibly modify
+ * @param[in] pfes The FiniteElementSpace that the element matrices are defined on
+ * @param[in] local_matrix A callback returning the processor-local matrix summed from the current element gradients
+ * @param[in] essential_tdofs The essential true DOFs of the physics module
+ * @note A full copy of the object is made, pending C++20 relaxation of "mutable"
+ */
+inline LinearSolverOptions AugmentElementPreconditioner(const LinearSolverOptions&                 init_options,
+                                                        mfem::ParFiniteElementSpace&               pfes,
+                                                        std::function<const mfem::SparseMatrix&()> local_matrix,
+                                                        const mfem::Array<int>&                    essential_tdofs)
+{
+  auto augmented_options = init_options;
+  if (auto iter_options = std::get_if<IterativeSolverOptions>(&augmented_options)) {
+    if (iter_options->prec) {
+      if (auto element_options = std::get_if<ElementSchwarzPrec>(&iter_options->prec.value())) {
+        element_options->pfes            = &pfes;
+        element_options->local_matrix    = local_matrix;
+        element_options->essential_tdofs = &essential_tdofs;
+      }
+    }
+  }
+  return augmented_options;
+}
+
 }  // namespace serac::mfem_ext
 
 /**
@@ -72,16 +72,19 @@ public:
 
       evaluation_ = EvaluationKernel{eval_config, J, X, N, num_elements, qf};
 
-      for_constexpr<num_trial_spaces>([this, num_elements, quadrature_points_per_element, &J, &X, &N, &qf,
+      // allocate memory for the derivatives of the q-function w.r.t. each trial space at each quadrature point
+      //
+      // Note: ptrs' lifetime is managed in an unusual way! Each array is captured by-value in the
+      // action_of_gradient functors below to augment the reference count, and extend its lifetime to match
+      // that of the BoundaryIntegral that allocated it.
+      auto ptrs = allocate_derivatives<exec, dim, trials...>(qf, num_elements * quadrature_points_per_element,
+                                                             std::make_integer_sequence<int, num_trial_spaces>{});
+
+      for_constexpr<num_trial_spaces>([this, num_elements, quadrature_points_per_element, &J, &X, &N, &qf, &ptrs,
                                        eval_config](auto i) {
-        // allocate memory for the derivatives of the q-function at each quadrature point
-        //
-        // Note: ptrs' lifetime is managed in an unusual way! It is captured by-value in the
-        // action_of_gradient functor below to augment the reference count, and extend its lifetime to match
-        // that of the DomainIntegral that allocated it.
         using which_trial_space = typename serac::tuple_element<i, serac::tuple<trials...> >::type;
         using derivative_type   = decltype(get_derivative_type<i, dim, trials...>(qf));
-        auto ptr = accelerator::make_shared_array<exec, derivative_type>(num_elements * quadrature_points_per_element);
+        auto ptr                = std::get<i>(ptrs);
         ExecArrayView<derivative_type, 2, exec> qf_derivatives(ptr.get(), num_elements, quadrature_points_per_element);
 
         evaluation_with_AD_[i] =
@@ -93,10 +96,34 @@ public:
           action_of_gradient_kernel<geometry, test, which_trial_space, Q>(dU, dR, qf_derivatives, J, num_elements);
         };
 
+        if constexpr (test::family != Family::QOI) {
+          action_of_gradient_transpose_[i] = [ptr, qf_derivatives, num_elements, J](const mfem::Vector& dR,
+                                                                                     mfem::Vector&       dU) {
+            action_of_gradient_transpose_kernel<geometry, test, which_trial_space, Q>(dR, dU, qf_derivatives, J,
+                                                                                      num_elements);
+          };
+        }
+
         element_gradient_[i] = [qf_derivatives, num_elements, J](CPUArrayView<double, 3> K_e) {
           element_gradient_kernel<geometry, test, which_trial_space, Q>(K_e, qf_derivatives, J, num_elements);
         };
       });
+
+      // when there is more than one trial space, all of the derivatives above can also be computed in a single pass,
+      // with the arguments promoted to dual numbers w.r.t. every trial space at once. That kernel is a separate
+      // instantiation of the q-function, so it is only compiled for q-functions marked with single_pass_derivatives
+      if constexpr (num_trial_spaces > 1 && num_trial_spaces <= max_trial_spaces_per_evaluation &&
+                    is_single_pass_integrand<std::decay_t<lambda_type>>::value) {
+        auto qf_derivatives = std::apply(
+            [num_elements, quadrature_points_per_element](auto&... ptr) {
+              return std::tuple{ExecArrayView<typename std::decay_t<decltype(ptr)>::element_type, 2, exec>(
+                  ptr.get(), num_elements, quadrature_points_per_element)...};
+            },
+            ptrs);
+
+        evaluation_with_all_AD_ =
+            EvaluationKernel{DerivativeWRTAll{}, eval_config, qf_derivatives, J, X, N, num_elements, qf};
+      }
     }
   }
 
@@ -105,12 +132,25 @@ public:
    * @param[in] input_E The input to the evaluation; per-element DOF values
    * @param[out] output_E The output of the evalution; per-element DOF residuals
    * @param[in] which the index of the argument being differentiated,
-   *    which == -1 corresponds to direct evaluation without any differentiation
+   *    which == -1 corresponds to direct evaluation without any differentiation,
+   *    which == all_trial_spaces differentiates w.r.t. every argument in a single pass
    */
   void Mult(const std::array<mfem::Vector, num_trial_spaces>& input_E, mfem::Vector& output_E, int which) const
   {
     if (which == -1) {
       evaluation_(input_E, output_E);
+    } else if (which == all_trial_spaces) {
+      if (evaluation_with_all_AD_) {
+        evaluation_with_all_AD_(input_E, output_E);
+      } else {
+        // without the single-pass kernel, differentiate w.r.t. one argument at a time,
+        // keeping the value from the first pass only
+        evaluation_with_AD_[0](input_E, output_E);
+        discarded_E_.SetSize(output_E.Size());
+        for (int i = 1; i < num_trial_spaces; i++) {
+          evaluation_with_AD_[i](input_E, discarded_E_);
+        }
+      }
     } else {
       evaluation_with_AD_[which](input_E, output_E);
     }
@@ -128,6 +168,18 @@ public:
     action_of_gradient_[which](input_E, output_E);
   }
 
+  /**
+   * @brief Applies the transposed gradient, i.e., @a output_E = transpose(gradient) * @a input_E
+   * @param[in] input_E The input to the evaluation; per-element test space values
+   * @param[out] output_E The output of the evalution; per-element trial space residuals
+   * @param[in] which the index of the argument being differentiated
+   * @see action_of_gradient_transpose_kernel
+   */
+  void GradientMultTranspose(const mfem::Vector& input_E, mfem::Vector& output_E, std::size_t which) const
+  {
+    action_of_gradient_transpose_[which](input_E, output_E);
+  }
+
   /**
    * @brief Computes the derivative of each element's residual with respect to the element values
    * @param[inout] K_b The reshaped vector as a mfem::DeviceTensor of size (test_dim * test_dof, trial_dim * trial_dof,
@@ -147,9 +199,19 @@ private:
   std::function<void(const std::array<mfem::Vector, num_trial_spaces>&, mfem::Vector&)>
       evaluation_with_AD_[num_trial_spaces];
 
+  /// @brief kernel for integrating the q-function over the domain, and caching its derivatives w.r.t. every argument,
+  /// empty unless the q-function was marked with single_pass_derivatives
+  std::function<void(const std::array<mfem::Vector, num_trial_spaces>&, mfem::Vector&)> evaluation_with_all_AD_;
+
+  /// @brief the element residuals of the passes after the first one, when differentiating one argument at a time
+  mutable mfem::Vector discarded_E_;
+
   /// @brief kernels for computing directional derivatives, using the most recently cached q-function derivatives
   std::function<void(const mfem::Vector&, mfem::Vector&)> action_of_gradient_[num_trial_spaces];
 
+  /// @brief kernels for computing the action of the transposed gradient, using the same q-function derivatives
+  std::function<void(const mfem::Vector&, mfem::Vector&)> action_of_gradient_transpose_[num_trial_spaces];
+
   /// @brief kernels for computing consistent "element stiffness" matrices
   std::function<void(ExecArrayView<double, 3, exec>)> element_gradient_[num_trial_spaces];
 };
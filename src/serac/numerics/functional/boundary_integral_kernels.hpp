@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 #pragma once
 
+#include "serac/infrastructure/accelerator.hpp"
 #include "serac/numerics/quadrature_data.hpp"
 #include "serac/numerics/functional/integral_utilities.hpp"
 #include "serac/numerics/functional/evector_view.hpp"
@@ -101,10 +102,23 @@ auto get_derivative_type(lambda qf)
       detail::apply_qf(qf, tensor<double, dim + 1>{}, tensor<double, dim + 1>{}, make_dual_wrt<i>(qf_arguments{})));
 };
 
+/**
+ * @brief allocate containers for the derivatives of the q-function w.r.t. each trial space, at `n` quadrature points
+ */
+template <ExecutionSpace exec, int dim, typename... trials, typename lambda, int... i>
+auto allocate_derivatives(lambda qf, std::size_t n, std::integer_sequence<int, i...>)
+{
+  return accelerator::make_shared_arrays<exec, decltype(get_derivative_type<i, dim, trials...>(qf))...>(n);
+}
+
 template <int i>
 struct DerivativeWRT {
 };
 
+/// @brief tag type used to request derivatives w.r.t. every trial space from a single evaluation
+struct DerivativeWRTAll {
+};
+
 template <int Q, Geometry g, typename test, typename... trials>
 struct KernelConfig {
 };
@@ -113,6 +127,7 @@ struct KernelConfig {
  * @tparam S type used to specify which argument to differentiate with respect to.
  *    `void` => evaluation kernel with no differentiation
  *    `DerivativeWRT<i>` => evaluation kernel with AD applied to trial space `i`
+ *    `DerivativeWRTAll` => evaluation kernel with AD applied to every trial space at once
  * @tparam T the "function signature" of the form `test(trial0, trial1, ...)`
  * @tparam derivatives_type the type of the derivative of the q-function
  * @tparam lambda the type of the q-function
@@ -325,6 +340,119 @@ struct EvaluationKernel<DerivativeWRT<I>, KernelConfig<Q, geom, test, trials...>
   lambda                                   qf_;              ///< q-function
 };
 
+/**
+ * @overload
+ * @note evaluation kernel that also calculates the derivatives w.r.t. every trial space, in a single pass
+ */
+template <int Q, Geometry geom, typename test, typename... trials, typename... derivatives_type, typename lambda>
+struct EvaluationKernel<DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>, std::tuple<derivatives_type...>,
+                        lambda> {
+  static constexpr auto exec             = ExecutionSpace::CPU;     ///< this specialization is CPU-specific
+  static constexpr int  num_trial_spaces = int(sizeof...(trials));  ///< how many trial spaces are provided
+
+  using EVector_t =
+      EVectorView<exec, finite_element<geom, trials>...>;  ///< the type of container used to access element values
+
+  /**
+   * @brief initialize the functor by providing the necessary quadrature point data
+   *
+   * @param qf_derivatives containers for the derivatives of the q-function w.r.t. each trial space
+   * @param J values of sqrt(det(J^T * J)) at each quadrature point
+   * @param X Spatial positions of each quadrature point
+   * @param N Unit surface normals at each quadrature point
+   * @param num_elements how many elements in the domain
+   * @param qf q-function
+   */
+  EvaluationKernel(DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>,
+                   std::tuple<CPUArrayView<derivatives_type, 2>...> qf_derivatives, const mfem::Vector& J,
+                   const mfem::Vector& X, const mfem::Vector& N, std::size_t num_elements, lambda qf)
+      : qf_derivatives_(qf_derivatives), J_(J), X_(X), N_(N), num_elements_(num_elements), qf_(qf)
+  {
+  }
+
+  /**
+   * @brief integrate the q-function over the specified domain, at the specified trial space values
+   *
+   * @param U input E-vectors
+   * @param R output E-vector
+   */
+  void operator()(const std::array<mfem::Vector, num_trial_spaces>& U, mfem::Vector& R)
+  {
+    std::array<const double*, num_trial_spaces> ptrs;
+    for (uint32_t j = 0; j < num_trial_spaces; j++) {
+      ptrs[j] = U[j].Read();
+    }
+    EVector_t u(ptrs, std::size_t(num_elements_));
+
+    using test_element              = finite_element<geom, test>;
+    using element_residual_type     = typename test_element::residual_type;
+    static constexpr int  dim       = dimension_of(geom);
+    static constexpr int  test_ndof = test_element::ndof;
+    static constexpr auto rule      = GaussQuadratureRule<geom, Q>();
+
+    // mfem provides this information in 1D arrays, so we reshape it
+    // into strided multidimensional arrays before using
+    auto X = mfem::Reshape(X_.Read(), rule.size(), dim + 1, num_elements_);
+    auto N = mfem::Reshape(N_.Read(), rule.size(), dim + 1, num_elements_);
+    auto J = mfem::Reshape(J_.Read(), rule.size(), num_elements_);
+    auto r = detail::Reshape<test>(R.ReadWrite(), test_ndof, int(num_elements_));  // TODO: integer conversions
+
+    // for each element in the domain
+    for (uint32_t e = 0; e < num_elements_; e++) {
+      // get the DOF values for this particular element
+      auto u_elem = u[e];
+
+      // this is where we will accumulate the element residual tensor
+      element_residual_type r_elem{};
+
+      // for each quadrature point in the element
+      for (int q = 0; q < static_cast<int>(rule.size()); q++) {
+        // get the position of this quadrature point in the parent and physical space,
+        // and calculate the measure of that point in physical space.
+        auto   xi  = rule.points[q];
+        auto   dxi = rule.weights[q];
+        auto   x_q = make_tensor<dim + 1>([&](int i) { return X(q, i, e); });  // Physical coords of qpt
+        auto   n_q = make_tensor<dim + 1>([&](int i) { return N(q, i, e); });  // Physical coords of unit normal
+        double dx  = J(q, e) * dxi;
+
+        // evaluate the value/derivatives needed for the q-function at this quadrature point
+        auto arg = Preprocess<geom, trials...>(u_elem, xi);
+
+        // evaluate the user-specified constitutive model
+        //
+        // note: make_dual_wrt_all(arg) promotes every argument to a dual number type with
+        // a block-structured gradient, so that qf_output will contain values and all derivatives
+        auto qf_output = detail::apply_qf(qf_, x_q, n_q, make_dual_wrt_all(arg));
+
+        // integrate qf_output against test space shape functions / gradients
+        // to get element residual contributions
+        r_elem += Postprocess<test_element>(get_value(qf_output), xi) * dx;
+
+        // here, we split the derivatives of the q-function into the blocks for each trial space, and store
+        // them in the same layout as the single trial space kernels so the other kernels can use them as is
+        auto gradient = get_gradient(qf_output);
+        for_constexpr<num_trial_spaces>([&](auto j) {
+          assign_gradient_block<j>(std::get<j>(qf_derivatives_)(static_cast<size_t>(e), static_cast<size_t>(q)),
+                                   gradient);
+        });
+      }
+
+      // once we've finished the element integration loop, write our element residuals
+      // out to memory, to be later assembled into global residuals by mfem
+      detail::Add(r, r_elem, int(e));
+    }
+  }
+
+  /// derivatives of the q-function w.r.t. each trial space
+  std::tuple<ExecArrayView<derivatives_type, 2, exec>...> qf_derivatives_;
+
+  const mfem::Vector& J_;             ///< values of sqrt(det(J^T * J)) at each quadrature point
+  const mfem::Vector& X_;             ///< Spatial positions of each quadrature point
+  const mfem::Vector& N_;             ///< Unit surface normals at each quadrature point
+  std::size_t         num_elements_;  ///< how many elements in the domain
+  lambda              qf_;            ///< q-function
+};
+
 template <int Q, Geometry geom, typename test, typename... trials, typename lambda>
 EvaluationKernel(KernelConfig<Q, geom, test, trials...>, const mfem::Vector&, const mfem::Vector&, const mfem::Vector&,
                  int, lambda) -> EvaluationKernel<void, KernelConfig<Q, geom, test, trials...>, void, lambda>;
@@ -334,6 +462,13 @@ EvaluationKernel(DerivativeWRT<i>, KernelConfig<Q, geom, test, trials...>, CPUAr
                  const mfem::Vector&, const mfem::Vector&, const mfem::Vector&, int, lambda)
     -> EvaluationKernel<DerivativeWRT<i>, KernelConfig<Q, geom, test, trials...>, derivatives_type, lambda>;
 
+template <int Q, Geometry geom, typename test, typename... trials, typename... derivatives_type, typename lambda>
+EvaluationKernel(DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>,
+                 std::tuple<CPUArrayView<derivatives_type, 2>...>, const mfem::Vector&, const mfem::Vector&,
+                 const mfem::Vector&, int, lambda)
+    -> EvaluationKernel<DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>, std::tuple<derivatives_type...>,
+                        lambda>;
+
 /**
  * @brief The base kernel template used to create create custom directional derivative
  * kernels associated with finite element calculations
@@ -417,6 +552,67 @@ void action_of_gradient_kernel(const mfem::Vector& dU, mfem::Vector& dR,
   }
 }
 
+/**
+ * @brief The kernel template used to compute the action of the transposed gradient, i.e. the directional
+ * derivative kernel with the roles of Preprocess and Postprocess swapped
+ *
+ * @tparam test The type of the test function space (not QOI)
+ * @tparam trial The type of the trial function space
+ * @tparam g The shape of the element (only quadrilateral and hexahedron are supported at present)
+ * @tparam Q Quadrature parameter describing how many points per dimension
+ * @tparam derivatives_type Type representing the derivative of the q-function w.r.t. its input arguments
+ *
+ * @param[in] dR The full set of per-element test space values (primary input)
+ * @param[inout] dU The full set of per-element trial space residuals (primary output)
+ * @param[in] qf_derivatives The derivatives of the q-function with respect to its arguments
+ * @param[in] J_ The Jacobians of the element transformations at all quadrature points
+ * @see mfem::GeometricFactors
+ * @param[in] num_elements The number of elements in the mesh
+ */
+template <Geometry g, typename test, typename trial, int Q, typename derivatives_type>
+void action_of_gradient_transpose_kernel(const mfem::Vector& dR, mfem::Vector& dU,
+                                         CPUArrayView<derivatives_type, 2> qf_derivatives, const mfem::Vector& J_,
+                                         std::size_t num_elements)
+{
+  using test_element               = finite_element<g, test>;
+  using trial_element              = finite_element<g, trial>;
+  using element_residual_type      = typename trial_element::residual_type;
+  static constexpr int  test_ndof  = test_element::ndof;
+  static constexpr int  trial_ndof = trial_element::ndof;
+  static constexpr auto rule       = GaussQuadratureRule<g, Q>();
+
+  static_assert(test::family != Family::QOI, "the transposed gradient of a quantity of interest is not supported");
+
+  auto J  = mfem::Reshape(J_.Read(), rule.size(), num_elements);
+  auto dr = detail::Reshape<test>(dR.Read(), test_ndof, int(num_elements));
+  auto du = detail::Reshape<trial>(dU.ReadWrite(), trial_ndof, int(num_elements));
+
+  for (uint32_t e = 0; e < num_elements; e++) {
+    tensor dr_elem = detail::Load<test_element>(dr, int(e));
+
+    element_residual_type du_elem{};
+
+    for (int q = 0; q < static_cast<int>(rule.size()); q++) {
+      auto   xi  = rule.points[q];
+      auto   dxi = rule.weights[q];
+      double dx  = J(q, e) * dxi;
+
+      // interpolate the test space values, which the q-function output multiplies
+      auto dq = Preprocess<test_element>(dr_elem, xi);
+
+      auto dq_darg = qf_derivatives(static_cast<size_t>(e), static_cast<size_t>(q));
+
+      // see the note on serac::get<0>(...) in action_of_gradient_kernel
+      auto darg = serac::get<0>(dq) * serac::get<0>(dq_darg);
+
+      // integrate against the trial space shape functions
+      du_elem += Postprocess<trial_element>(darg, xi) * dx;
+    }
+
+    detail::Add(du, du_elem, int(e));
+  }
+}
+
 /**
  * @brief The base kernel template used to create create custom element stiffness matrices
  * associated with finite element calculations
@@ -472,7 +668,7 @@ void element_gradient_kernel(CPUArrayView<double, 3> dk, CPUArrayView<derivative
       // recall the derivative of the q-function w.r.t. its arguments at this quadrature point
       auto dq_darg = qf_derivatives(static_cast<size_t>(e), static_cast<size_t>(q));
 
-      if constexpr (std::is_same<test, QOI>::value) {
+      if constexpr (test::family == Family::QOI) {
         auto N = trial_element::shape_functions(xi_q);
         for (int j = 0; j < trial_ndof; j++) {
           K_elem[0][j] += serac::get<0>(dq_darg) * N[j] * dx;
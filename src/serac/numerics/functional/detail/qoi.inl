@@ -10,15 +10,15 @@
  * @brief Specialization of finite_element for expressing quantities of interest on any geometry
  */
 /// @cond
-template <Geometry g>
-struct finite_element<g, QOI> {
+template <Geometry g, int n>
+struct finite_element<g, VectorQOI<n> > {
   static constexpr auto geometry   = g;
   static constexpr auto family     = Family::QOI;
-  static constexpr int  components = 1;
+  static constexpr int  components = n;
   static constexpr int  dim        = 1;
   static constexpr int  ndof       = 1;
 
-  using residual_type = double;
+  using residual_type = std::conditional_t<n == 1, double, tensor<double, n> >;
 
   SERAC_HOST_DEVICE static constexpr double shape_functions(double /* xi */) { return 1.0; }
 };
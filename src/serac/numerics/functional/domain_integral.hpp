@@ -71,16 +71,20 @@ public:
 
       evaluation_ = EvaluationKernel{eval_config, J, X, num_elements, qf, data};
 
-      for_constexpr<num_trial_spaces>([this, num_elements, quadrature_points_per_element, &J, &X, &qf, &data,
+      // allocate memory for the derivatives of the q-function w.r.t. each trial space at each quadrature point
+      //
+      // Note: ptrs' lifetime is managed in an unusual way! Each array is captured by-value in the
+      // action_of_gradient functors below to augment the reference count, and extend its lifetime to match
+      // that of the DomainIntegral that allocated it.
+      auto ptrs = allocate_derivatives<exec, dim, trials...>(
+          qf, data(0, 0), num_elements * quadrature_points_per_element,
+          std::make_integer_sequence<int, num_trial_spaces>{});
+
+      for_constexpr<num_trial_spaces>([this, num_elements, quadrature_points_per_element, &J, &X, &qf, &data, &ptrs,
                                        eval_config](auto i) {
-        // allocate memory for the derivatives of the q-function at each quadrature point
-        //
-        // Note: ptrs' lifetime is managed in an unusual way! It is captured by-value in the
-        // action_of_gradient functor below to augment the reference count, and extend its lifetime to match
-        // that of the DomainIntegral that allocated it.
         using which_trial_space = typename serac::tuple_element<i, serac::tuple<trials...> >::type;
         using derivative_type   = decltype(get_derivative_type<i, dim, trials...>(qf, data(0, 0)));
-        auto ptr = accelerator::make_shared_array<exec, derivative_type>(num_elements * quadrature_points_per_element);
+        auto ptr                = std::get<i>(ptrs);
         ExecArrayView<derivative_type, 2, exec> qf_derivatives(ptr.get(), num_elements, quadrature_points_per_element);
 
         evaluation_with_AD_[i] =
@@ -93,11 +97,36 @@ public:
                                                                                            num_elements);
         };
 
+        // the transposed action is only needed for residuals, e.g. by adjoint solves
+        if constexpr (test::family != Family::QOI) {
+          action_of_gradient_transpose_[i] = [ptr, qf_derivatives, num_elements, J](const mfem::Vector& dR,
+                                                                                     mfem::Vector&       dU) {
+            domain_integral::action_of_gradient_transpose_kernel<geometry, test, which_trial_space, Q>(
+                dR, dU, qf_derivatives, J, num_elements);
+          };
+        }
+
         element_gradient_[i] = [qf_derivatives, num_elements, J](CPUArrayView<double, 3> K_e) {
           domain_integral::element_gradient_kernel<geometry, test, which_trial_space, Q>(K_e, qf_derivatives, J,
                                                                                          num_elements);
         };
       });
+
+      // when there is more than one trial space, all of the derivatives above can also be computed in a single pass,
+      // with the arguments promoted to dual numbers w.r.t. every trial space at once. That kernel is a separate
+      // instantiation of the q-function, so it is only compiled for q-functions marked with single_pass_derivatives
+      if constexpr (num_trial_spaces > 1 && num_trial_spaces <= max_trial_spaces_per_evaluation &&
+                    is_single_pass_integrand<std::decay_t<lambda_type>>::value) {
+        auto qf_derivatives = std::apply(
+            [num_elements, quadrature_points_per_element](auto&... ptr) {
+              return std::tuple{ExecArrayView<typename std::decay_t<decltype(ptr)>::element_type, 2, exec>(
+                  ptr.get(), num_elements, quadrature_points_per_element)...};
+            },
+            ptrs);
+
+        evaluation_with_all_AD_ =
+            EvaluationKernel{DerivativeWRTAll{}, eval_config, qf_derivatives, J, X, num_elements, qf, data};
+      }
     }
 
 // some of the GPU functionality is temporarily disabled to
@@ -146,7 +175,7 @@ public:
    * @param[in] which_trial_space specifies which trial space to compute derivatives with respect to (if any)
    *
    * @note which_trial_space == -1 implies that this function will call the evaluation kernel that performs no
-   * differentiation
+   * differentiation, and which_trial_space == all_trial_spaces computes the derivatives w.r.t. every trial space
    */
   void Mult(const std::array<mfem::Vector, num_trial_spaces>& input_E, mfem::Vector& output_E,
             int which_trial_space) const
@@ -155,6 +184,20 @@ public:
       SERAC_MARK_BEGIN("Domain Integral Evaluation");
       evaluation_(input_E, output_E);
       SERAC_MARK_END("Domain Integral Evaluation");
+    } else if (which_trial_space == all_trial_spaces) {
+      SERAC_MARK_BEGIN("Domain Integral Evaluation with AD w.r.t. all trial spaces");
+      if (evaluation_with_all_AD_) {
+        evaluation_with_all_AD_(input_E, output_E);
+      } else {
+        // without the single-pass kernel, differentiate w.r.t. one trial space at a time,
+        // keeping the value from the first pass only
+        evaluation_with_AD_[0](input_E, output_E);
+        discarded_E_.SetSize(output_E.Size());
+        for (int i = 1; i < num_trial_spaces; i++) {
+          evaluation_with_AD_[i](input_E, discarded_E_);
+        }
+      }
+      SERAC_MARK_END("Domain Integral Evaluation with AD w.r.t. all trial spaces");
     } else {
       SERAC_MARK_BEGIN("Domain Integral Evaluation with AD");
       evaluation_with_AD_[which_trial_space](input_E, output_E);
@@ -175,6 +218,19 @@ public:
     SERAC_MARK_END("Domain Integral Action of Gradient");
   }
 
+  /**
+   * @brief Applies the transposed gradient, i.e., @a output_E = transpose(gradient) * @a input_E
+   * @param[in] input_E The input to the evaluation; per-element test space values
+   * @param[out] output_E The output of the evalution; per-element trial space residuals
+   * @param[in] which_trial_space specifies which trial space output_E correpsonds to
+   */
+  void GradientMultTranspose(const mfem::Vector& input_E, mfem::Vector& output_E, std::size_t which_trial_space) const
+  {
+    SERAC_MARK_BEGIN("Domain Integral Action of Transposed Gradient");
+    action_of_gradient_transpose_[which_trial_space](input_E, output_E);
+    SERAC_MARK_END("Domain Integral Action of Transposed Gradient");
+  }
+
   /**
    * @brief Computes the element stiffness matrices, storing them in an `mfem::Vector` that has been reshaped into a
    * multidimensional array
@@ -197,9 +253,20 @@ private:
   std::function<void(const std::array<mfem::Vector, num_trial_spaces>&, mfem::Vector&)>
       evaluation_with_AD_[num_trial_spaces];
 
+  /// @brief Type-erased handle to the evaluation kernel that differentiates w.r.t. every trial space in one pass,
+  /// empty unless the q-function was marked with single_pass_derivatives
+  std::function<void(const std::array<mfem::Vector, num_trial_spaces>&, mfem::Vector&)> evaluation_with_all_AD_;
+
+  /// @brief The element residuals of the passes after the first one, when differentiating w.r.t. one trial space
+  /// at a time
+  mutable mfem::Vector discarded_E_;
+
   /// @brief Type-erased handle to action of gradient kernels
   std::function<void(const mfem::Vector&, mfem::Vector&)> action_of_gradient_[num_trial_spaces];
 
+  /// @brief Type-erased handle to action of transposed gradient kernels
+  std::function<void(const mfem::Vector&, mfem::Vector&)> action_of_gradient_transpose_[num_trial_spaces];
+
   /// @brief Type-erased handle to gradient matrix assembly kernels
   std::function<void(ExecArrayView<double, 3, exec>)> element_gradient_[num_trial_spaces];
 };
@@ -66,10 +66,23 @@ auto get_derivative_type(lambda qf, qpt_data_type&& qpt_data)
   return get_gradient(detail::apply_qf(qf, tensor<double, dim>{}, make_dual_wrt<i>(qf_arguments{}), qpt_data));
 };
 
+/**
+ * @brief allocate containers for the derivatives of the q-function w.r.t. each trial space, at `n` quadrature points
+ */
+template <ExecutionSpace exec, int dim, typename... trials, typename lambda, typename qpt_data_type, int... i>
+auto allocate_derivatives(lambda qf, qpt_data_type&& qpt_data, std::size_t n, std::integer_sequence<int, i...>)
+{
+  return accelerator::make_shared_arrays<exec, decltype(get_derivative_type<i, dim, trials...>(qf, qpt_data))...>(n);
+}
+
 template <int i>
 struct DerivativeWRT {
 };
 
+/// @brief tag type used to request derivatives w.r.t. every trial space from a single evaluation
+struct DerivativeWRTAll {
+};
+
 template <int Q, Geometry g, typename test, typename... trials>
 struct KernelConfig {
 };
@@ -78,6 +91,7 @@ struct KernelConfig {
  * @tparam S type used to specify which argument to differentiate with respect to.
  *    `void` => evaluation kernel with no differentiation
  *    `DerivativeWRT<i>` => evaluation kernel with AD applied to trial space `i`
+ *    `DerivativeWRTAll` => evaluation kernel with AD applied to every trial space at once
  * @tparam T a configuration argument containing:
  *    quadrature rule information,
  *    element geometry
@@ -292,6 +306,122 @@ struct EvaluationKernel<DerivativeWRT<I>, KernelConfig<Q, geom, test, trials...>
   QuadratureData<qpt_data_type>&           data_;            ///< (optional) user-provided quadrature data
 };
 
+/**
+ * @overload
+ * @note evaluation kernel that also calculates the derivatives w.r.t. every trial space, in a single pass
+ */
+template <int Q, Geometry geom, typename test, typename... trials, typename... derivatives_type, typename lambda,
+          typename qpt_data_type>
+struct EvaluationKernel<DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>, std::tuple<derivatives_type...>,
+                        lambda, qpt_data_type> {
+  static constexpr auto exec             = ExecutionSpace::CPU;     ///< this specialization is CPU-specific
+  static constexpr int  num_trial_spaces = int(sizeof...(trials));  ///< how many trial spaces are provided
+
+  using EVector_t =
+      EVectorView<exec, finite_element<geom, trials>...>;  ///< the type of container used to access element values
+
+  /**
+   * @brief initialize the functor by providing the necessary quadrature point data
+   *
+   * @param qf_derivatives containers for the derivatives of the q-function w.r.t. each trial space
+   * @param J values of sqrt(det(J^T * J)) at each quadrature point
+   * @param X Spatial positions of each quadrature point
+   * @param num_elements how many elements in the domain
+   * @param qf q-function
+   * @param data user-specified quadrature data to pass to the q-function
+   */
+  EvaluationKernel(DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>,
+                   std::tuple<CPUArrayView<derivatives_type, 2>...> qf_derivatives, const mfem::Vector& J,
+                   const mfem::Vector& X, std::size_t num_elements, lambda qf, QuadratureData<qpt_data_type>& data)
+      : qf_derivatives_(qf_derivatives), J_(J), X_(X), num_elements_(num_elements), qf_(qf), data_(data)
+  {
+  }
+
+  /**
+   * @brief integrate the q-function over the specified domain, at the specified trial space values
+   *
+   * @param U input E-vectors
+   * @param R output E-vector
+   */
+  void operator()(const std::array<mfem::Vector, num_trial_spaces>& U, mfem::Vector& R)
+  {
+    std::array<const double*, num_trial_spaces> ptrs;
+    for (uint32_t j = 0; j < num_trial_spaces; j++) {
+      ptrs[j] = U[j].Read();
+    }
+    EVector_t u(ptrs, std::size_t(num_elements_));
+
+    using test_element              = finite_element<geom, test>;
+    using element_residual_type     = typename test_element::residual_type;
+    static constexpr int  dim       = dimension_of(geom);
+    static constexpr int  test_ndof = test_element::ndof;
+    static constexpr auto rule      = GaussQuadratureRule<geom, Q>();
+
+    // mfem provides this information in 1D arrays, so we reshape it
+    // into strided multidimensional arrays before using
+    auto X = mfem::Reshape(X_.Read(), rule.size(), dim, num_elements_);
+    auto J = mfem::Reshape(J_.Read(), rule.size(), dim, dim, num_elements_);
+    auto r = detail::Reshape<test>(R.ReadWrite(), test_ndof, int(num_elements_));  // TODO: integer conversions
+
+    // for each element in the domain
+    for (uint32_t e = 0; e < num_elements_; e++) {
+      // get the DOF values for this particular element
+      auto u_elem = u[e];
+
+      // this is where we will accumulate the element residual tensor
+      element_residual_type r_elem{};
+
+      // for each quadrature point in the element
+      for (int q = 0; q < static_cast<int>(rule.size()); q++) {
+        auto   xi  = rule.points[q];
+        auto   dxi = rule.weights[q];
+        auto   x_q = make_tensor<dim>([&](int i) { return X(q, i, e); });  // Physical coords of qpt
+        auto   J_q = make_tensor<dim, dim>([&](int i, int j) { return J(q, i, j, e); });
+        double dx  = det(J_q) * dxi;
+
+        // evaluate the value/derivatives needed for the q-function at this quadrature point
+        auto arg = Preprocess<geom, trials...>(u_elem, xi, J_q);
+
+        // evaluate the user-specified constitutive model
+        //
+        // note: make_dual_wrt_all(arg) promotes every argument to a dual number type with
+        // a block-structured gradient, so that qf_output will contain values and all derivatives
+        auto qf_output = detail::apply_qf(qf_, x_q, make_dual_wrt_all(arg), data_(int(e), q));
+
+        // integrate qf_output against test space shape functions / gradients
+        // to get element residual contributions
+        r_elem += Postprocess<test_element>(get_value(qf_output), xi, J_q) * dx;
+
+        // here, we split the derivatives of the q-function into the blocks for each trial space, and store
+        // them in the same layout as the single trial space kernels so the other kernels can use them as is
+        auto gradient = get_gradient(qf_output);
+        for_constexpr<num_trial_spaces>([&](auto j) {
+          auto& derivatives = std::get<j>(qf_derivatives_)(static_cast<size_t>(e), static_cast<size_t>(q));
+          if constexpr (test::family == Family::QOI) {
+            assign_gradient_block<j>(derivatives, gradient);
+          } else {
+            assign_gradient_block<j>(serac::get<0>(derivatives), serac::get<0>(gradient));
+            assign_gradient_block<j>(serac::get<1>(derivatives), serac::get<1>(gradient));
+          }
+        });
+      }
+
+      // once we've finished the element integration loop, write our element residuals
+      // out to memory, to be later assembled into global residuals by mfem
+      detail::Add(r, r_elem, int(e));
+    }
+  }
+
+  /// derivatives of the q-function w.r.t. each trial space
+  std::tuple<ExecArrayView<derivatives_type, 2, exec>...> qf_derivatives_;
+
+  const mfem::Vector&            J_;             ///< Jacobian matrix entries at each quadrature point
+  const mfem::Vector&            X_;             ///< Spatial positions of each quadrature point
+  std::size_t                    num_elements_;  ///< how many elements in the domain
+  lambda                         qf_;            ///< q-function
+  QuadratureData<qpt_data_type>& data_;          ///< (optional) user-provided quadrature data
+};
+
 template <int Q, Geometry geom, typename test, typename... trials, typename lambda, typename qpt_data_type>
 EvaluationKernel(KernelConfig<Q, geom, test, trials...>, const mfem::Vector&, const mfem::Vector&, int, lambda,
                  QuadratureData<qpt_data_type>&)
@@ -304,6 +434,14 @@ EvaluationKernel(DerivativeWRT<i>, KernelConfig<Q, geom, test, trials...>, CPUAr
     -> EvaluationKernel<DerivativeWRT<i>, KernelConfig<Q, geom, test, trials...>, derivatives_type, lambda,
                         qpt_data_type>;
 
+template <int Q, Geometry geom, typename test, typename... trials, typename... derivatives_type, typename lambda,
+          typename qpt_data_type>
+EvaluationKernel(DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>,
+                 std::tuple<CPUArrayView<derivatives_type, 2>...>, const mfem::Vector&, const mfem::Vector&, int,
+                 lambda, QuadratureData<qpt_data_type>&)
+    -> EvaluationKernel<DerivativeWRTAll, KernelConfig<Q, geom, test, trials...>, std::tuple<derivatives_type...>,
+                        lambda, qpt_data_type>;
+
 //clang-format off
 template <bool is_QOI, typename S, typename T>
 auto chain_rule(const S& dfdx, const T& dx)
@@ -320,6 +458,19 @@ auto chain_rule(const S& dfdx, const T& dx)
                             serac::chain_rule(serac::get<1>(serac::get<1>(dfdx)), serac::get<1>(dx))};
   }
 }
+
+/**
+ * @brief the transpose of chain_rule<false>: given a change in the (value, flux) output of the q-function,
+ * computes the change in its (value, derivative) input arguments that it is sensitive to
+ */
+template <typename S, typename T>
+auto transposed_chain_rule(const S& dfdx, const T& df)
+{
+  return serac::tuple{serac::transposed_chain_rule(serac::get<0>(serac::get<0>(dfdx)), serac::get<0>(df)) +
+                          serac::transposed_chain_rule(serac::get<0>(serac::get<1>(dfdx)), serac::get<1>(df)),
+                      serac::transposed_chain_rule(serac::get<1>(serac::get<0>(dfdx)), serac::get<0>(df)) +
+                          serac::transposed_chain_rule(serac::get<1>(serac::get<1>(dfdx)), serac::get<1>(df))};
+}
 //clang-format on
 
 /**
@@ -404,6 +555,71 @@ void action_of_gradient_kernel(const mfem::Vector& dU, mfem::Vector& dR,
   }
 }
 
+/**
+ * @brief The kernel template used to compute the action of the transposed gradient, i.e. the directional
+ * derivative kernel with the roles of Preprocess and Postprocess swapped
+ *
+ * The test space values are interpolated at each quadrature point, contracted with the derivatives of the
+ * q-function output w.r.t. its arguments, and integrated against the trial space shape functions / gradients.
+ *
+ * @tparam test The type of the test function space (not QOI)
+ * @tparam trial The type of the trial function space
+ * @tparam g The shape of the element (only quadrilateral and hexahedron are supported at present)
+ * @tparam Q Quadrature parameter describing how many points per dimension
+ * @tparam derivatives_type Type representing the derivative of the q-function w.r.t. its input arguments
+ *
+ * @param[in] dR The full set of per-element test space values (primary input)
+ * @param[inout] dU The full set of per-element trial space residuals (primary output)
+ * @param[in] qf_derivatives The derivatives of the q-function with respect to its arguments
+ * @param[in] J_ The Jacobians of the element transformations at all quadrature points
+ * @see mfem::GeometricFactors
+ * @param[in] num_elements The number of elements in the mesh
+ */
+template <Geometry g, typename test, typename trial, int Q, typename derivatives_type>
+void action_of_gradient_transpose_kernel(const mfem::Vector& dR, mfem::Vector& dU,
+                                         CPUArrayView<derivatives_type, 2> qf_derivatives, const mfem::Vector& J_,
+                                         std::size_t num_elements)
+{
+  using test_element               = finite_element<g, test>;
+  using trial_element              = finite_element<g, trial>;
+  using element_residual_type      = typename trial_element::residual_type;
+  static constexpr int  dim        = dimension_of(g);
+  static constexpr int  test_ndof  = test_element::ndof;
+  static constexpr int  trial_ndof = trial_element::ndof;
+  static constexpr auto rule       = GaussQuadratureRule<g, Q>();
+
+  static_assert(test::family != Family::QOI, "the transposed gradient of a quantity of interest is not supported");
+
+  auto J  = mfem::Reshape(J_.Read(), rule.size(), dim, dim, num_elements);
+  auto dr = detail::Reshape<test>(dR.Read(), test_ndof, int(num_elements));
+  auto du = detail::Reshape<trial>(dU.ReadWrite(), trial_ndof, int(num_elements));
+
+  for (uint32_t e = 0; e < num_elements; e++) {
+    tensor dr_elem = detail::Load<test_element>(dr, int(e));
+
+    element_residual_type du_elem{};
+
+    for (int q = 0; q < static_cast<int>(rule.size()); q++) {
+      auto   xi  = rule.points[q];
+      auto   dxi = rule.weights[q];
+      auto   J_q = make_tensor<dim, dim>([&](int i, int j) { return J(q, i, j, e); });
+      double dx  = det(J_q) * dxi;
+
+      // interpolate the test space values and derivatives, which the q-function's (value, flux) outputs multiply
+      auto dq = Preprocess<test_element>(dr_elem, xi, J_q);
+
+      auto dq_darg = qf_derivatives(static_cast<size_t>(e), static_cast<size_t>(q));
+
+      auto darg = transposed_chain_rule(dq_darg, dq);
+
+      // integrate against the trial space shape functions / gradients
+      du_elem += Postprocess<trial_element>(darg, xi, J_q) * dx;
+    }
+
+    detail::Add(du, du_elem, static_cast<int>(e));
+  }
+}
+
 /**
  * @brief The base kernel template used to compute tangent element entries that can be assembled
  * into a tangent matrix
@@ -459,7 +675,7 @@ void element_gradient_kernel(ExecArrayView<double, 3, ExecutionSpace::CPU> dk,
       // recall the derivative of the q-function w.r.t. its arguments at this quadrature point
       auto dq_darg = qf_derivatives(static_cast<size_t>(e), static_cast<size_t>(q));
 
-      if constexpr (std::is_same<test, QOI>::value) {
+      if constexpr (test::family == Family::QOI) {
         auto& q0 = serac::get<0>(dq_darg);  // derivative of QoI w.r.t. field value
         auto& q1 = serac::get<1>(dq_darg);  // derivative of QoI w.r.t. field derivative
 
@@ -470,7 +686,7 @@ void element_gradient_kernel(ExecArrayView<double, 3, ExecutionSpace::CPU> dk,
         }
       }
 
-      if constexpr (!std::is_same<test, QOI>::value) {
+      if constexpr (test::family != Family::QOI) {
         auto& q00 = serac::get<0>(serac::get<0>(dq_darg));  // derivative of source term w.r.t. field value
         auto& q01 = serac::get<1>(serac::get<0>(dq_darg));  // derivative of source term w.r.t. field derivative
         auto& q10 = serac::get<0>(serac::get<1>(dq_darg));  // derivative of   flux term w.r.t. field value
@@ -497,15 +713,13 @@ void element_gradient_kernel(ExecArrayView<double, 3, ExecutionSpace::CPU> dk,
     // once we've finished the element integration loop, write our element gradients
     // out to memory, to be later assembled into the global gradient by mfem
     // clang-format off
-    if constexpr (std::is_same< test, QOI >::value) {
-      for (int k = 0; k < trial_ndof; k++) {
-        for (int l = 0; l < trial_dim; l++) {
-          dk(static_cast<size_t>(e), 0, static_cast<size_t>(k + trial_ndof * l)) += K_elem[0][k][0][l];
-        }
-      }
+    if constexpr (test::family == Family::QOI) {
+      for_loop<test_dim, trial_ndof, trial_dim>([&](int j, int k, int l) {
+        dk(static_cast<size_t>(e), static_cast<size_t>(j), static_cast<size_t>(k + trial_ndof * l)) += K_elem[0][k][j][l];
+      });
     } 
 
-    if constexpr (!std::is_same< test, QOI >::value) {
+    if constexpr (test::family != Family::QOI) {
       // Note: we "transpose" these values to get them into the layout that mfem expects
       for_loop<test_ndof, test_dim, trial_ndof, trial_dim>([&](int i, int j, int k, int l) {
         dk(static_cast<size_t>(e), static_cast<size_t>(i + test_ndof * j), static_cast<size_t>(k + trial_ndof * l)) += K_elem[i][k][j][l];
@@ -118,13 +118,20 @@ struct L2 {
 
 /**
  * @brief "Quantity of Interest" elements (i.e. elements with a single shape function, 1)
+ * @tparam n The number of quantities of interest integrated together
  */
-struct QOI {
+template <int n>
+struct VectorQOI {
   static constexpr int    order      = 0;            ///< the polynomial order of the elements
-  static constexpr int    components = 1;            ///< the number of components at each node
+  static constexpr int    components = n;            ///< the number of components at each node
   static constexpr Family family     = Family::QOI;  ///< the family of the basis functions
 };
 
+/**
+ * @brief "Quantity of Interest" elements for a single quantity of interest
+ */
+using QOI = VectorQOI<1>;
+
 /**
  * @brief Template prototype for finite element implementations
  * @tparam g The geometry of the element
@@ -12,6 +12,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 #include "mfem.hpp"
 
 #include "serac/infrastructure/logger.hpp"
@@ -39,7 +43,9 @@ struct differentiate_wrt_this {
 /**
  * @brief this function is intended to only be used in combination with
  *   `serac::Functional::operator()`, as a way for the user to express that
- *   it should both evaluate and differentiate w.r.t. a specific argument (only 1 argument at a time)
+ *   it should both evaluate and differentiate w.r.t. a specific argument. Marking several arguments
+ *   computes the derivatives w.r.t. each of them in one call, and in a single evaluation of the integrals
+ *   whose q-functions are marked with `single_pass_derivatives`.
  *
  * For example:
  * @code{.cpp}
@@ -47,6 +53,8 @@ struct differentiate_wrt_this {
  *     mfem::Vector arg1 = ...;
  *     mfem::Vector just_the_value = my_functional(arg0, arg1);
  *     auto [value, gradient_wrt_arg1] = my_functional(arg0, differentiate_wrt(arg1));
+ *     auto [value, gradient_wrt_arg0, gradient_wrt_arg1] =
+ *         my_functional(differentiate_wrt(arg0), differentiate_wrt(arg1));
  * @endcode
  */
 auto differentiate_wrt(const mfem::Vector& v) { return differentiate_wrt_this{v}; }
@@ -74,6 +82,35 @@ constexpr int index_of_differentiation()
   return -1;
 }
 
+/**
+ * @tparam T a list of types, any number of which may be `differentiate_wrt_this`
+ *
+ * @brief given a list of types, this struct lists the indices that correspond to the type `differentiate_wrt_this`
+ *
+ * e.g.
+ * @code{.cpp}
+ * static_assert(indices_of_differentiation < differentiate_wrt_this, foo, differentiate_wrt_this >::value[1] == 2);
+ * @endcode
+ */
+template <typename... T>
+struct indices_of_differentiation {
+  /// how many of the types are `differentiate_wrt_this`
+  static constexpr std::size_t size = (std::size_t(std::is_same_v<T, differentiate_wrt_this>) + ... + 0);
+
+  /// the indices of the types that are `differentiate_wrt_this`, in increasing order
+  static constexpr std::array<int, size> value = []() {
+    std::array<int, size> indices{};
+    constexpr bool        matching[] = {std::is_same_v<T, differentiate_wrt_this>...};
+    std::size_t           k          = 0;
+    for (std::size_t i = 0; i < sizeof...(T); i++) {
+      if (matching[i]) {
+        indices[k++] = int(i);
+      }
+    }
+    return indices;
+  }();
+};
+
 /**
  * @brief Compile-time alias for index of differentiation
  */
@@ -137,15 +174,6 @@ class Functional<test(trials...), exec> {
   class Gradient;
 
   // clang-format off
-  template <typename... T>
-  struct operator_paren_return {
-    using type = typename std::conditional<
-        (std::is_same_v<T, differentiate_wrt_this> + ...) == 1, // if the there is a dual number in the pack
-        serac::tuple<mfem::Vector&, Gradient&>,                 // then we return the value and the derivative
-        mfem::Vector&                                           // otherwise, we just return the value
-        >::type;
-  };
-
   template <int indx>
   struct operator_paren_return_index {
     using type = typename std::conditional<
@@ -155,6 +183,10 @@ class Functional<test(trials...), exec> {
         >::type;
   };
 
+  /// @brief the type returned by operator() for the derivative w.r.t. the argument with index `indx`
+  template <int indx>
+  using gradient_reference = Gradient&;
+
   // clang-format on
 
 public:
@@ -177,6 +209,7 @@ public:
             mfem::ElementDofOrdering::LEXICOGRAPHIC, mfem::FaceType::Boundary, mfem::L2FaceValues::SingleValued);
 
         input_E_boundary_[i].SetSize(G_trial_boundary_[i]->Height(), mfem::Device::GetMemoryType());
+        input_L_boundary_[i].SetSize(P_trial_[i]->Height(), mfem::Device::GetMemoryType());
       }
 
       input_L_[i].SetSize(P_trial_[i]->Height(), mfem::Device::GetMemoryType());
@@ -205,14 +238,7 @@ public:
 
     output_T_.SetSize(test_fes->GetTrueVSize(), mfem::Device::GetMemoryType());
 
-    auto num_elements          = static_cast<size_t>(test_space_->GetNE());
-    auto ndof_per_test_element = static_cast<size_t>(test_space_->GetFE(0)->GetDof() * test_space_->GetVDim());
-    for (uint32_t i = 0; i < num_trial_spaces; i++) {
-      auto ndof_per_trial_element =
-          static_cast<size_t>(trial_space_[i]->GetFE(0)->GetDof() * trial_space_[i]->GetVDim());
-      element_gradients_[i] = ExecArray<double, 3, exec>(num_elements, ndof_per_test_element, ndof_per_trial_element);
-      bdr_element_gradients_[i] = allocateMemoryForBdrElementGradients<double, exec>(*test_space_, *trial_space_[i]);
-    }
+    input_T_.reserve(num_trial_spaces);
   }
 
   /**
@@ -371,30 +397,80 @@ public:
     P_test_->MultTranspose(output_L_, output_T);
   }
 
+  /**
+   * @brief this function computes the action of the transposed gradient of `serac::Functional::operator()`,
+   * by running the directional derivative kernels with the roles of the test and trial spaces swapped
+   *
+   * @param input_T the T-vector (in the test space) to apply the action of the transposed gradient to
+   * @param output_T the T-vector (in the trial space) where the resulting values are stored
+   * @param which describes which trial space output_T corresponds to
+   *
+   * @note the q-function derivatives are those of the most recent evaluation that differentiated w.r.t. @a which
+   */
+  void ActionOfGradientTranspose(const mfem::Vector& input_T, mfem::Vector& output_T, std::size_t which) const
+  {
+    P_test_->Mult(input_T, output_L_);
+
+    input_L_[which] = 0.0;
+    if (domain_integrals_.size() > 0) {
+      // get the test space values for each element on the local processor
+      G_test_->Mult(output_L_, output_E_);
+
+      input_E_[which] = 0.0;
+      for (auto& integral : domain_integrals_) {
+        integral.GradientMultTranspose(output_E_, input_E_[which], which);
+      }
+
+      // scatter-add to the trial space dofs on the local processor
+      G_trial_[which]->MultTranspose(input_E_[which], input_L_[which]);
+    }
+
+    if (bdr_integrals_.size() > 0) {
+      G_test_boundary_->Mult(output_L_, output_E_boundary_);
+
+      input_E_boundary_[which] = 0.0;
+      for (auto& integral : bdr_integrals_) {
+        integral.GradientMultTranspose(output_E_boundary_, input_E_boundary_[which], which);
+      }
+
+      input_L_boundary_[which] = 0.0;
+
+      G_trial_boundary_[which]->MultTranspose(input_E_boundary_[which], input_L_boundary_[which]);
+
+      input_L_[which] += input_L_boundary_[which];
+    }
+
+    P_trial_[which]->MultTranspose(input_L_[which], output_T);
+  }
+
   /**
    * @brief this function lets the user evaluate the serac::Functional with the given trial space values
    *
-   * note: it accepts exactly `num_trial_spaces` arguments of type mfem::Vector. Additionally, one of those
+   * note: it accepts exactly `num_trial_spaces` arguments of type mfem::Vector. Additionally, any of those
    * arguments may be a dual_vector, to indicate that Functional::operator() should not only evaluate the
-   * element calculations, but also differentiate them w.r.t. the specified dual_vector argument
+   * element calculations, but also differentiate them w.r.t. the specified dual_vector arguments
    *
    * @tparam T the types of the arguments passed in
    * @param args the trial space dofs used to carry out the calculation,
-   *  at most one of which may be of the type `differentiate_wrt_this(mfem::Vector)`
+   *  any of which may be of the type `differentiate_wrt_this(mfem::Vector)`
    */
   template <typename... T>
-  typename operator_paren_return<T...>::type operator()(const T&... args)
+  decltype(auto) operator()(const T&... args)
   {
-    constexpr int num_differentiated_arguments = (std::is_same_v<T, differentiate_wrt_this> + ...);
-    static_assert(num_differentiated_arguments <= 1,
-                  "Error: Functional::operator() can only differentiate w.r.t. 1 argument a time");
     static_assert(sizeof...(T) == num_trial_spaces,
                   "Error: Functional::operator() must take exactly as many arguments as trial spaces");
 
-    [[maybe_unused]] constexpr int                          wrt = index_of_differentiation<T...>();
-    std::vector<std::reference_wrapper<const mfem::Vector>> input_T{args...};
+    using wrt = indices_of_differentiation<T...>;
+
+    // the arguments are gathered in preallocated storage, so repeated evaluations do not allocate
+    input_T_.clear();
+    (input_T_.push_back(args), ...);
 
-    return (*this)(input_T, Index<wrt>{});
+    if constexpr (wrt::size == 0) {
+      return (*this)(input_T_, Index<-1>{});
+    } else {
+      return differentiate<wrt>(std::make_integer_sequence<int, int(wrt::size)>{});
+    }
   }
 
   /**
@@ -405,7 +481,7 @@ public:
    *
    * @param input_T an array of trial space dofs used to carry out the calculation.
    */
-  mfem::Vector& operator()(std::vector<std::reference_wrapper<const mfem::Vector>> input_T)
+  mfem::Vector& operator()(const std::vector<std::reference_wrapper<const mfem::Vector>>& input_T)
   {
     SLIC_ERROR_IF(input_T.size() != num_trial_spaces,
                   "The input vector of trial spaces is not equal to the number of trial spaces defined in the "
@@ -423,7 +499,66 @@ public:
    */
   template <int wrt>
   typename operator_paren_return_index<wrt>::type operator()(
-      std::vector<std::reference_wrapper<const mfem::Vector>> input_T, Index<wrt>)
+      const std::vector<std::reference_wrapper<const mfem::Vector>>& input_T, Index<wrt>)
+  {
+    Evaluate(input_T, wrt);
+
+    if constexpr (wrt >= 0) {
+      // if the user has indicated they'd like to evaluate and differentiate w.r.t.
+      // a specific argument, then we return both the value and gradient w.r.t. that argument
+      //
+      // mfem::Vector arg0 = ...;
+      // mfem::Vector arg1 = ...;
+      // e.g. auto [value, gradient_wrt_arg1] = my_functional(arg0, differentiate_wrt(arg1));
+      return {output_T_, grad_[wrt]};
+    }
+    if constexpr (wrt == -1) {
+      // if the user passes only `mfem::Vector`s then we assume they only want the output value
+      //
+      // mfem::Vector arg0 = ...;
+      // mfem::Vector arg1 = ...;
+      // e.g. mfem::Vector value = my_functional(arg0, arg1);
+      return output_T_;
+    }
+  }
+
+  /**
+   * @brief this function lets the user evaluate the serac::Functional with the given trial space values,
+   * and differentiate it w.r.t. several of them at once
+   *
+   * note: it accepts a vector of mfem::Vectors that must be of length `num_trial_spaces`. The q-functions marked
+   * with `single_pass_derivatives` are evaluated once with dual numbers w.r.t. every trial space, so the derivatives
+   * w.r.t. the requested arguments come from the same evaluation as the value. The other integrals are evaluated
+   * once per trial space.
+   *
+   * @tparam wrt The indices of the input trial vectors to additionally compute derivatives with respect to
+   * @param input_T an array of trial space dofs used to carry out the calculation.
+   *
+   * e.g. auto [value, gradient_wrt_arg0, gradient_wrt_arg1] = my_functional(input_T, Index<0>{}, Index<1>{});
+   */
+  template <int... wrt, typename = std::enable_if_t<(sizeof...(wrt) > 1)>>
+  serac::tuple<mfem::Vector&, gradient_reference<wrt>...> operator()(
+      const std::vector<std::reference_wrapper<const mfem::Vector>>& input_T, Index<wrt>...)
+  {
+    static_assert(1 < num_trial_spaces && int(num_trial_spaces) <= max_trial_spaces_per_evaluation,
+                  "Error: Functional::operator() can only differentiate w.r.t. several arguments at once "
+                  "for Functionals with 2 to 4 trial spaces");
+    static_assert(((0 <= wrt && wrt < int(num_trial_spaces)) && ...),
+                  "Error: Functional::operator() differentiation index out of range");
+
+    Evaluate(input_T, all_trial_spaces);
+
+    return {output_T_, grad_[wrt]...};
+  }
+
+private:
+  /**
+   * @brief evaluates the residual for the given trial space values, leaving it in output_T_
+   *
+   * @param input_T an array of trial space dofs used to carry out the calculation.
+   * @param which which trial space to differentiate w.r.t.: -1 for none, or all_trial_spaces for every one of them
+   */
+  void Evaluate(const std::vector<std::reference_wrapper<const mfem::Vector>>& input_T, int which)
   {
     // get the values for each local processor
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
@@ -440,7 +575,7 @@ public:
       // compute residual contributions at the element level and sum them
       output_E_ = 0.0;
       for (auto& integral : domain_integrals_) {
-        integral.Mult(input_E_, output_E_, wrt);
+        integral.Mult(input_E_, output_E_, which);
       }
 
       // scatter-add to compute residuals on the local processor
@@ -454,7 +589,7 @@ public:
 
       output_E_boundary_ = 0.0;
       for (auto& integral : bdr_integrals_) {
-        integral.Mult(input_E_boundary_, output_E_boundary_, wrt);
+        integral.Mult(input_E_boundary_, output_E_boundary_, which);
       }
 
       output_L_boundary_ = 0.0;
@@ -467,27 +602,37 @@ public:
 
     // scatter-add to compute global residuals
     P_test_->MultTranspose(output_L_, output_T_);
+  }
 
-    if constexpr (wrt >= 0) {
-      // if the user has indicated they'd like to evaluate and differentiate w.r.t.
-      // a specific argument, then we return both the value and gradient w.r.t. that argument
-      //
-      // mfem::Vector arg0 = ...;
-      // mfem::Vector arg1 = ...;
-      // e.g. auto [value, gradient_wrt_arg1] = my_functional(arg0, differentiate_wrt(arg1));
-      return {output_T_, grad_[wrt]};
-    }
-    if constexpr (wrt == -1) {
-      // if the user passes only `mfem::Vector`s then we assume they only want the output value
-      //
-      // mfem::Vector arg0 = ...;
-      // mfem::Vector arg1 = ...;
-      // e.g. mfem::Vector value = my_functional(arg0, arg1);
-      return output_T_;
-    }
+  /**
+   * @brief allocates the storage for the element and boundary element gradients w.r.t. one trial space
+   *
+   * @param which the trial space whose element gradients are allocated
+   *
+   * @note these dense arrays are only needed to assemble sparse matrices, so the Gradient objects call this
+   * the first time they are assembled, and gradients that are only used for their (transposed) action never do
+   */
+  void allocateElementGradients(uint32_t which)
+  {
+    auto num_elements          = static_cast<size_t>(test_space_->GetNE());
+    auto ndof_per_test_element = static_cast<size_t>(test_space_->GetFE(0)->GetDof() * test_space_->GetVDim());
+    auto ndof_per_trial_element =
+        static_cast<size_t>(trial_space_[which]->GetFE(0)->GetDof() * trial_space_[which]->GetVDim());
+    element_gradients_[which] = ExecArray<double, 3, exec>(num_elements, ndof_per_test_element, ndof_per_trial_element);
+    bdr_element_gradients_[which] =
+        allocateMemoryForBdrElementGradients<double, exec>(*test_space_, *trial_space_[which]);
+  }
+
+  /**
+   * @brief evaluates the residual and differentiates it w.r.t. the arguments listed by `wrt`,
+   * which were gathered in input_T_ by the variadic operator()
+   */
+  template <typename wrt, int... k>
+  auto differentiate(std::integer_sequence<int, k...>)
+  {
+    return (*this)(input_T_, Index<wrt::value[k]>{}...);
   }
 
-private:
   /**
    * @brief mfem::Operator representing the gradient matrix that
    * can compute the action of the gradient (with operator()),
@@ -502,7 +647,6 @@ private:
     Gradient(Functional<test(trials...), exec>& f, uint32_t which = 0)
         : mfem::Operator(f.test_space_->GetTrueVSize(), f.trial_space_[which]->GetTrueVSize()),
           form_(f),
-          lookup_tables(*(f.test_space_), *(f.trial_space_[which])),
           which_argument(which),
           test_space_(f.test_space_),
           trial_space_(f.trial_space_[which]),
@@ -520,6 +664,16 @@ private:
       form_.ActionOfGradient(dx, df, which_argument);
     }
 
+    /**
+     * @brief implement that action of the transposed gradient: dx := transpose(df_dx) * df
+     * @param[in] df a small perturbation in the residuals
+     * @param[out] dx the resulting sensitivities in the trial space
+     */
+    virtual void MultTranspose(const mfem::Vector& df, mfem::Vector& dx) const override
+    {
+      form_.ActionOfGradientTranspose(df, dx, which_argument);
+    }
+
     /// @brief syntactic sugar:  df_dx.Mult(dx, df)  <=>  mfem::Vector df = df_dx(dx);
     mfem::Vector& operator()(const mfem::Vector& dx)
     {
@@ -527,26 +681,29 @@ private:
       return df_;
     }
 
-    /// @brief assemble element matrices and form an mfem::HypreParMatrix
-    std::unique_ptr<mfem::HypreParMatrix> assemble()
+    /**
+     * @brief compute the element matrices and sum them into the processor-local sparse matrix,
+     * without forming the parallel (global) matrix
+     *
+     * @note the returned matrix is owned by this object, and is overwritten by subsequent
+     * calls to assembleLocal() or assemble()
+     */
+    const mfem::SparseMatrix& assembleLocal()
     {
-      // the CSR graph (sparsity pattern) is reusable, so we cache
-      // that and ask mfem to not free that memory in ~SparseMatrix()
-      constexpr bool sparse_matrix_frees_graph_ptrs = false;
-
-      // the CSR values are NOT reusable, so we pass ownership of
-      // them to the mfem::SparseMatrix, to be freed in ~SparseMatrix()
-      constexpr bool sparse_matrix_frees_values_ptr = true;
-
-      constexpr bool col_ind_is_sorted = true;
+      // the sparsity pattern and the element gradients are only needed for assembly,
+      // so they are not created for gradients that are only used for their action
+      if (!lookup_tables) {
+        lookup_tables.emplace(*test_space_, *trial_space_);
+        form_.allocateElementGradients(which_argument);
+      }
 
-      double* values = new double[lookup_tables.nnz]{};
+      local_values_.assign(lookup_tables->nnz, 0.0);
 
       // each element uses the lookup tables to add its contributions
       // to their appropriate locations in the global sparse matrix
       if (form_.domain_integrals_.size() > 0) {
         auto& K_elem = form_.element_gradients_[which_argument];
-        auto& LUT    = lookup_tables.element_nonzero_LUT;
+        auto& LUT    = lookup_tables->element_nonzero_LUT;
 
         detail::zero_out(K_elem);
         for (auto& domain : form_.domain_integrals_) {
@@ -557,7 +714,7 @@ private:
           for (axom::IndexType i = 0; i < K_elem.shape()[1]; i++) {
             for (axom::IndexType j = 0; j < K_elem.shape()[2]; j++) {
               auto [index, sign] = LUT(e, i, j);
-              values[index] += sign * K_elem(e, i, j);
+              local_values_[index] += sign * K_elem(e, i, j);
             }
           }
         }
@@ -567,7 +724,7 @@ private:
       // to their appropriate locations in the global sparse matrix
       if (form_.bdr_integrals_.size() > 0) {
         auto& K_belem = form_.bdr_element_gradients_[which_argument];
-        auto& LUT     = lookup_tables.bdr_element_nonzero_LUT;
+        auto& LUT     = lookup_tables->bdr_element_nonzero_LUT;
 
         detail::zero_out(K_belem);
         for (auto& boundary : form_.bdr_integrals_) {
@@ -578,17 +735,126 @@ private:
           for (axom::IndexType i = 0; i < K_belem.shape()[1]; i++) {
             for (axom::IndexType j = 0; j < K_belem.shape()[2]; j++) {
               auto [index, sign] = LUT(e, i, j);
-              values[index] += sign * K_belem(e, i, j);
+              local_values_[index] += sign * K_belem(e, i, j);
             }
           }
         }
       }
 
+      // the processor-local matrix only references the cached sparsity pattern and values,
+      // so it only needs to be created once
+      if (!local_matrix_) {
+        constexpr bool sparse_matrix_frees_graph_ptrs = false;
+        constexpr bool sparse_matrix_frees_values_ptr = false;
+        constexpr bool col_ind_is_sorted              = true;
+
+        local_col_ind_ = lookup_tables->col_ind;
+        local_matrix_.emplace(lookup_tables->row_ptr.data(), local_col_ind_.data(), local_values_.data(),
+                              form_.output_L_.Size(), form_.input_L_[which_argument].Size(),
+                              sparse_matrix_frees_graph_ptrs, sparse_matrix_frees_values_ptr, col_ind_is_sorted);
+      }
+
+      return *local_matrix_;
+    }
+
+    /**
+     * @brief compute the processor-local sparse matrix of the linear combination alpha * A + beta * (this gradient)
+     * in a single pass over the shared sparsity pattern
+     *
+     * @param[in] alpha the scale of A
+     * @param[in] A a processor-local matrix with the same sparsity pattern as this gradient,
+     *   e.g. the localMatrix() of the gradient of another Functional with the same test and trial spaces;
+     *   its row offsets and column indices are compared against this gradient's and a mismatch is an error
+     * @param[in] beta the scale of this gradient
+     *
+     * @note the returned matrix is owned by this object, and is overwritten by subsequent
+     * calls to assembleLocal() or assemble()
+     */
+    const mfem::SparseMatrix& assembleLocal(double alpha, const mfem::SparseMatrix& A, double beta)
+    {
+      assembleLocal();
+
+      // the values are combined entry by entry, so the row offsets and column indices must agree exactly,
+      // which is immediate when A shares the arrays of this gradient
+      const int  height     = static_cast<int>(lookup_tables->row_ptr.size()) - 1;
+      const bool same_shape = A.Height() == height && A.Width() == local_matrix_->Width() &&
+                              A.NumNonZeroElems() == static_cast<int>(lookup_tables->nnz);
+      const bool same_I     = same_shape && (A.GetI() == lookup_tables->row_ptr.data() ||
+                                         std::equal(A.GetI(), A.GetI() + height + 1, lookup_tables->row_ptr.begin()));
+      const bool same_J     = same_I && (A.GetJ() == local_col_ind_.data() ||
+                                     std::equal(A.GetJ(), A.GetJ() + lookup_tables->nnz, local_col_ind_.begin()));
+      SLIC_ERROR_IF(!same_J, "linear combinations of gradients require a shared sparsity pattern");
+
+      const double* A_values = A.GetData();
+      for (size_t i = 0; i < local_values_.size(); i++) {
+        local_values_[i] = alpha * A_values[i] + beta * local_values_[i];
+      }
+
+      return *local_matrix_;
+    }
+
+    /**
+     * @brief the processor-local sparse matrix computed by the most recent call to assembleLocal() or assemble()
+     */
+    const mfem::SparseMatrix& localMatrix() const
+    {
+      SLIC_ERROR_IF(!local_matrix_, "assembleLocal() or assemble() must be called before localMatrix()");
+      return *local_matrix_;
+    }
+
+    /// @brief assemble element matrices and form an mfem::HypreParMatrix
+    std::unique_ptr<mfem::HypreParMatrix> assemble()
+    {
+      assembleLocal();
+      return formParallelMatrix();
+    }
+
+    /**
+     * @brief form the mfem::HypreParMatrix of the linear combination alpha * A + beta * (this gradient),
+     * without forming any intermediate parallel matrices
+     *
+     * @see assembleLocal(double, const mfem::SparseMatrix&, double)
+     */
+    std::unique_ptr<mfem::HypreParMatrix> assemble(double alpha, const mfem::SparseMatrix& A, double beta)
+    {
+      assembleLocal(alpha, A, beta);
+      return formParallelMatrix();
+    }
+
+    friend auto assemble(Gradient& g) { return g.assemble(); }
+
+    /**
+     * @brief assemble alpha * A + beta * B for the gradients of two Functionals with the same test and trial spaces
+     */
+    friend auto assemble(double alpha, Gradient& A, double beta, Gradient& B)
+    {
+      return B.assemble(alpha, A.assembleLocal(), beta);
+    }
+
+  private:
+    /// @brief form the parallel (global) matrix from the most recently computed processor-local values
+    std::unique_ptr<mfem::HypreParMatrix> formParallelMatrix()
+    {
+      // the CSR graph (sparsity pattern) is reusable, so we cache
+      // that and ask mfem to not free that memory in ~SparseMatrix()
+      constexpr bool sparse_matrix_frees_graph_ptrs = false;
+
+      // the CSR values are NOT reusable, so we pass ownership of
+      // them to the mfem::SparseMatrix, to be freed in ~SparseMatrix()
+      constexpr bool sparse_matrix_frees_values_ptr = true;
+
+      constexpr bool col_ind_is_sorted = true;
+
+      // MFEM can mutate the values (along with the column indices) during HypreParMatrix construction,
+      // so the parallel matrix is built from a copy of the processor-local values
+      double* values = new double[lookup_tables->nnz];
+      std::copy(local_values_.begin(), local_values_.end(), values);
+
       // Copy the column indices to an auxilliary array as MFEM can mutate these during HypreParMatrix construction
-      col_ind_copy_ = lookup_tables.col_ind;
+      col_ind_copy_ = lookup_tables->col_ind;
 
       auto J_local =
-          mfem::SparseMatrix(lookup_tables.row_ptr.data(), col_ind_copy_.data(), values, form_.output_L_.Size(),
+          mfem::SparseMatrix(lookup_tables->row_ptr.data(), col_ind_copy_.data(), values, form_.output_L_.Size(),
                              form_.input_L_[which_argument].Size(), sparse_matrix_frees_graph_ptrs,
                              sparse_matrix_frees_values_ptr, col_ind_is_sorted);
 
@@ -607,18 +873,15 @@ private:
       return K;
     };
 
-    friend auto assemble(Gradient& g) { return g.assemble(); }
-
-  private:
     /// @brief The "parent" @p Functional to calculate gradients with
     Functional<test(trials...), exec>& form_;
 
     /**
      * @brief this object has lookup tables for where to place each
      *   element and boundary element gradient contribution in the global
-     *   sparse matrix
+     *   sparse matrix, built the first time the gradient is assembled
      */
-    GradientAssemblyLookupTables lookup_tables;
+    std::optional<GradientAssemblyLookupTables> lookup_tables;
 
     /**
      * @brief Copy of the column indices for sparse matrix assembly
@@ -626,6 +889,15 @@ private:
      */
     std::vector<int> col_ind_copy_;
 
+    /// @brief Copy of the column indices referenced by the processor-local sparse matrix
+    std::vector<int> local_col_ind_;
+
+    /// @brief The nonzero values of the processor-local sparse matrix
+    std::vector<double> local_values_;
+
+    /// @brief The processor-local sparse matrix, referencing the cached sparsity pattern and local_values_
+    std::optional<mfem::SparseMatrix> local_matrix_;
+
     /**
      * @brief this member variable tells us which argument the associated Functional this gradient
      *  corresponds to:
@@ -669,9 +941,16 @@ private:
   /// @brief The output set of local DOF values (i.e., on the current rank) from boundary elements
   mutable mfem::Vector output_L_boundary_;
 
+  /// @brief The input set of local DOF values (i.e., on the current rank) from boundary elements, used by the
+  /// transposed gradient
+  mutable std::array<mfem::Vector, num_trial_spaces> input_L_boundary_;
+
   /// @brief The set of true DOF values, a reference to this member is returned by @p operator()
   mutable mfem::Vector output_T_;
 
+  /// @brief Storage for the arguments of the variadic @p operator(), reserved once to avoid reallocation
+  std::vector<std::reference_wrapper<const mfem::Vector>> input_T_;
+
   /// @brief Manages DOFs for the test space
   mfem::ParFiniteElementSpace* test_space_;
 
@@ -727,10 +1006,12 @@ private:
   /// @brief The objects representing the gradients w.r.t. each input argument of the Functional
   mutable std::vector<Gradient> grad_;
 
-  /// @brief 3D array that stores each element's gradient of the residual w.r.t. trial values
+  /// @brief 3D array that stores each element's gradient of the residual w.r.t. trial values, allocated on
+  /// first assembly
   ExecArray<double, 3, exec> element_gradients_[num_trial_spaces];
 
-  /// @brief 3D array that stores each boundary element's gradient of the residual w.r.t. trial values
+  /// @brief 3D array that stores each boundary element's gradient of the residual w.r.t. trial values, allocated on
+  /// first assembly
   ExecArray<double, 3, exec> bdr_element_gradients_[num_trial_spaces];
 };
 
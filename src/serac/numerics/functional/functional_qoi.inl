@@ -14,12 +14,13 @@ namespace serac {
 
 /**
  * @brief this class behaves like a Prolongation operator, except is specialized for
- * the case of a quantity of interest. The action of its MultTranspose() operator (the
- * only thing it is used for) sums the values from different processors.
+ * the case of quantities of interest. The action of its MultTranspose() operator (the
+ * only thing it is used for) sums the values from different processors, with a single
+ * reduction for all of the quantities of interest.
  */
 struct QoIProlongation : public mfem::Operator {
-  /// @brief create a QoIProlongation for a Quantity of Interest
-  QoIProlongation(MPI_Comm c) : mfem::Operator(1, 1), comm(c) {}
+  /// @brief create a QoIProlongation for @a n Quantities of Interest
+  QoIProlongation(MPI_Comm c, int n = 1) : mfem::Operator(n, n), comm(c) {}
 
   /// @brief unimplemented: do not use
   void Mult(const mfem::Vector&, mfem::Vector&) const override
@@ -30,7 +31,7 @@ struct QoIProlongation : public mfem::Operator {
   /// @brief set the value of output to the distributed sum over input values from different processors
   void MultTranspose(const mfem::Vector& input, mfem::Vector& output) const override
   {
-    MPI_Allreduce(&input[0], &output[0], 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(&input[0], &output[0], height, MPI_DOUBLE, MPI_SUM, comm);
   }
 
   MPI_Comm comm;  ///< MPI communicator used to carry out the distributed reduction
@@ -38,12 +39,12 @@ struct QoIProlongation : public mfem::Operator {
 
 /**
  * @brief this class behaves like a Restriction operator, except is specialized for
- * the case of a quantity of interest. The action of its MultTranspose() operator (the
+ * the case of quantities of interest. The action of its MultTranspose() operator (the
  * only thing it is used for) sums the values on this local processor.
  */
 struct QoIElementRestriction : public mfem::Operator {
-  /// @brief create a QoIElementRestriction for a Quantity of Interest
-  QoIElementRestriction(int num_elements) : mfem::Operator(num_elements, 1) {}
+  /// @brief create a QoIElementRestriction for @a n Quantities of Interest
+  QoIElementRestriction(int num_elements, int n = 1) : mfem::Operator(num_elements * n, n) {}
 
   /// @brief unimplemented: do not use
   void Mult(const mfem::Vector&, mfem::Vector&) const override
@@ -51,38 +52,72 @@ struct QoIElementRestriction : public mfem::Operator {
     SLIC_ERROR_ROOT("QoIElementRestriction::Mult() is not defined, exiting...");
   }
 
-  /// @brief set the value of output to the sum of the values of input
-  void MultTranspose(const mfem::Vector& input, mfem::Vector& output) const override { output[0] = input.Sum(); }
+  /// @brief set the value of output to the sum of the values of input, where each element's values are contiguous
+  void MultTranspose(const mfem::Vector& input, mfem::Vector& output) const override
+  {
+    if (width == 1) {
+      output[0] = input.Sum();
+      return;
+    }
+
+    output = 0.0;
+    for (int e = 0; e < height / width; e++) {
+      for (int i = 0; i < width; i++) {
+        output[i] += input[e * width + i];
+      }
+    }
+  }
 };
 
+/// @cond
+template <typename T, ExecutionSpace exec>
+class QoIFunctional;
+/// @endcond
+
+/// @cond
+namespace detail {
+
+/// @brief the number of quantities of interest in a value of type T: double, or tensor<double, n>
+template <typename T>
+struct num_qoi;
+
+template <>
+struct num_qoi<double> {
+  static constexpr int value = 1;
+};
+
+template <int n>
+struct num_qoi<tensor<double, n> > {
+  static constexpr int value = n;
+};
+
+}  // namespace detail
+/// @endcond
+
 /**
- * @brief a partial template specialization of Functional with test == double, implying "quantity of interest"
+ * @brief the implementation of Functional for quantities of interest, shared by the partial specializations
+ * for a single quantity of interest (qoi_type == double) and for several of them integrated together
+ * (qoi_type == tensor<double, n>)
  */
-template <typename... trials, ExecutionSpace exec>
-class Functional<double(trials...), exec> {
-  using test = QOI;
+template <typename qoi_type, typename... trials, ExecutionSpace exec>
+class QoIFunctional<qoi_type(trials...), exec> {
+  static constexpr int num_qoi = detail::num_qoi<qoi_type>::value;  ///< how many quantities of interest
+  using test                    = VectorQOI<num_qoi>;
   static constexpr tuple<trials...> trial_spaces{};
   static constexpr uint32_t         num_trial_spaces = sizeof...(trials);
 
   class Gradient;
 
-  // clang-format off
-  template <typename... T>
-  struct operator_paren_return {
-    using type = typename std::conditional<
-        (std::is_same_v<T, differentiate_wrt_this> + ...) == 1, // if the there is a dual number in the pack
-        serac::tuple<double, Gradient&>,                        // then we return the value and the derivative
-        double                                                  // otherwise, we just return the value
-        >::type;
-  };
-  // clang-format on
+  /// @brief the type returned by operator() for the derivative w.r.t. the argument with index `indx`
+  template <int indx>
+  using gradient_reference = Gradient&;
 
 public:
   /**
    * @brief Constructs using a @p mfem::ParFiniteElementSpace object corresponding to the trial space
    * @param[in] trial_fes The trial space
    */
-  Functional(std::array<mfem::ParFiniteElementSpace*, num_trial_spaces> trial_fes) : trial_space_(trial_fes)
+  QoIFunctional(std::array<mfem::ParFiniteElementSpace*, num_trial_spaces> trial_fes) : trial_space_(trial_fes)
   {
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
       P_trial_[i] = trial_space_[i]->GetProlongationMatrix();
@@ -103,9 +138,9 @@ public:
       grad_.emplace_back(*this, i);
     }
 
-    P_test_          = new QoIProlongation(trial_fes[0]->GetParMesh()->GetComm());
-    G_test_          = new QoIElementRestriction(trial_fes[0]->GetParMesh()->GetNE());
-    G_test_boundary_ = new QoIElementRestriction(trial_fes[0]->GetParMesh()->GetNBE());
+    P_test_          = new QoIProlongation(trial_fes[0]->GetParMesh()->GetComm(), num_qoi);
+    G_test_          = new QoIElementRestriction(trial_fes[0]->GetParMesh()->GetNE(), num_qoi);
+    G_test_boundary_ = new QoIElementRestriction(trial_fes[0]->GetParMesh()->GetNBE(), num_qoi);
 
     output_E_.SetSize(G_test_->Height(), mfem::Device::GetMemoryType());
     output_E_boundary_.SetSize(G_test_boundary_->Height(), mfem::Device::GetMemoryType());
@@ -113,12 +148,12 @@ public:
     output_L_.SetSize(P_test_->Height(), mfem::Device::GetMemoryType());
     output_L_boundary_.SetSize(P_test_->Height(), mfem::Device::GetMemoryType());
 
-    output_T_.SetSize(1, mfem::Device::GetMemoryType());
+    output_T_.SetSize(num_qoi, mfem::Device::GetMemoryType());
 
     for (uint32_t i = 0; i < num_trial_spaces; i++) {
       {
         auto num_elements          = static_cast<size_t>(trial_space_[i]->GetNE());
-        auto ndof_per_test_element = static_cast<size_t>(1);
+        auto ndof_per_test_element = static_cast<size_t>(num_qoi);
         auto ndof_per_trial_element =
             static_cast<size_t>(trial_space_[i]->GetFE(0)->GetDof() * trial_space_[i]->GetVDim());
         element_gradients_[i] = ExecArray<double, 3, exec>(num_elements, ndof_per_test_element, ndof_per_trial_element);
@@ -126,7 +161,7 @@ public:
 
       {
         auto num_bdr_elements          = static_cast<size_t>(trial_space_[i]->GetNFbyType(mfem::FaceType::Boundary));
-        auto ndof_per_test_bdr_element = static_cast<size_t>(1);
+        auto ndof_per_test_bdr_element = static_cast<size_t>(num_qoi);
         auto ndof_per_trial_bdr_element =
             static_cast<size_t>(trial_space_[i]->GetBE(0)->GetDof() * trial_space_[i]->GetVDim());
         bdr_element_gradients_[i] =
@@ -136,7 +171,7 @@ public:
   }
 
   /// @brief destructor: deallocate the mfem::Operators that we're responsible for
-  ~Functional()
+  ~QoIFunctional()
   {
     delete P_test_;
     delete G_test_;
@@ -255,7 +290,7 @@ public:
    * arguments may be a dual_vector, to indicate that Functional::operator() should not only evaluate the
    * element calculations, but also differentiate them w.r.t. the specified dual_vector argument
    */
-  double ActionOfGradient(const mfem::Vector& input_T, std::size_t which) const
+  qoi_type ActionOfGradient(const mfem::Vector& input_T, std::size_t which) const
   {
     P_trial_[which]->Mult(input_T, input_L_[which]);
 
@@ -294,7 +329,7 @@ public:
     // scatter-add to compute global residuals
     P_test_->MultTranspose(output_L_, output_T_);
 
-    return output_T_[0];
+    return value();
   }
 
   /**
@@ -302,20 +337,24 @@ public:
    *
    * @param args the input T-vectors
    *
-   * note: it accepts exactly `num_trial_spaces` arguments of type mfem::Vector. Additionally, one of those
+   * note: it accepts exactly `num_trial_spaces` arguments of type mfem::Vector. Additionally, any of those
    * arguments may be a dual_vector, to indicate that Functional::operator() should not only evaluate the
-   * element calculations, but also differentiate them w.r.t. the specified dual_vector argument
+   * element calculations, but also differentiate them w.r.t. the specified dual_vector arguments. Several
+   * arguments are differentiated in a single evaluation of the integrals whose q-functions are marked with
+   * `single_pass_derivatives`, and with one evaluation per trial space for the others.
    */
   template <typename... T>
-  typename operator_paren_return<T...>::type operator()(const T&... args)
+  auto operator()(const T&... args)
   {
-    constexpr int num_differentiated_arguments = (std::is_same_v<T, differentiate_wrt_this> + ...);
-    static_assert(num_differentiated_arguments <= 1,
-                  "Error: Functional::operator() can only differentiate w.r.t. 1 argument a time");
+    using wrt = indices_of_differentiation<T...>;
     static_assert(sizeof...(T) == num_trial_spaces,
                   "Error: Functional::operator() must take exactly as many arguments as trial spaces");
+    static_assert(wrt::size <= 1 || (1 < num_trial_spaces && int(num_trial_spaces) <= max_trial_spaces_per_evaluation),
+                  "Error: Functional::operator() can only differentiate w.r.t. several arguments at once "
+                  "for Functionals with 2 to 4 trial spaces");
 
-    [[maybe_unused]] constexpr int                                           wrt = index_of_differentiation<T...>();
+    // -1 for no differentiation, the index of the argument for one, or all_trial_spaces for several
+    constexpr int which = (wrt::size > 1) ? all_trial_spaces : index_of_differentiation<T...>();
     std::array<std::reference_wrapper<const mfem::Vector>, num_trial_spaces> input_T{args...};
 
     // get the values for each local processor
@@ -333,7 +372,7 @@ public:
       // compute residual contributions at the element level and sum them
       output_E_ = 0.0;
       for (auto& integral : domain_integrals_) {
-        integral.Mult(input_E_, output_E_, wrt);
+        integral.Mult(input_E_, output_E_, which);
       }
 
       // scatter-add to compute residuals on the local processor
@@ -347,7 +386,7 @@ public:
 
       output_E_boundary_ = 0.0;
       for (auto& integral : bdr_integrals_) {
-        integral.Mult(input_E_boundary_, output_E_boundary_, wrt);
+        integral.Mult(input_E_boundary_, output_E_boundary_, which);
       }
 
       output_L_boundary_ = 0.0;
@@ -361,27 +400,46 @@ public:
     // scatter-add to compute global residuals
     P_test_->MultTranspose(output_L_, output_T_);
 
-    if constexpr (num_differentiated_arguments == 0) {
+    if constexpr (wrt::size == 0) {
       // if the user passes only `mfem::Vector`s then we assume they only want the output value
       //
       // mfem::Vector arg0 = ...;
       // mfem::Vector arg1 = ...;
-      // e.g. mfem::Vector value = my_functional(arg0, arg1);
-      return output_T_[0];
-    }
-
-    if constexpr (num_differentiated_arguments == 1) {
+      // e.g. double value = my_functional(arg0, arg1);
+      return value();
+    } else {
       // if the user has indicated they'd like to evaluate and differentiate w.r.t.
-      // a specific argument, then we return both the value and gradient w.r.t. that argument
+      // specific arguments, then we return both the value and gradients w.r.t. those arguments
       //
       // mfem::Vector arg0 = ...;
       // mfem::Vector arg1 = ...;
       // e.g. auto [value, gradient_wrt_arg1] = my_functional(arg0, differentiate_wrt(arg1));
-      return {output_T_[0], grad_[wrt]};
+      return value_and_gradients<wrt>(std::make_integer_sequence<int, int(wrt::size)>{});
     }
   }
 
 private:
+  /**
+   * @brief packs the most recently evaluated value with the gradients w.r.t. the arguments listed by `wrt`
+   */
+  template <typename wrt, int... k>
+  serac::tuple<qoi_type, gradient_reference<wrt::value[k]>...> value_and_gradients(std::integer_sequence<int, k...>)
+  {
+    return {value(), grad_[wrt::value[k]]...};
+  }
+
+  /**
+   * @brief the most recently evaluated quantities of interest, stored in output_T_
+   */
+  qoi_type value() const
+  {
+    if constexpr (num_qoi == 1) {
+      return output_T_[0];
+    } else {
+      return make_tensor<num_qoi>([this](int i) { return output_T_[i]; });
+    }
+  }
+
   /**
    * @brief Indicates whether to obtain values or gradients from a calculation
    */
@@ -400,23 +458,31 @@ private:
      * @brief Constructs a Gradient wrapper that references a parent @p Functional
      * @param[in] f The @p Functional to use for gradient calculations
      */
-    Gradient(Functional<double(trials...)>& f, uint32_t which = 0)
-        : form_(f),
-          lookup_tables(*(f.trial_space_[which])),
-          which_argument(which),
-          gradient_L_(f.trial_space_[which]->GetVSize())
+    Gradient(QoIFunctional<qoi_type(trials...), exec>& f, uint32_t which = 0)
+        : form_(f), lookup_tables(*(f.trial_space_[which])), which_argument(which)
     {
+      for (auto& gradient_L : gradient_L_) {
+        gradient_L.SetSize(f.trial_space_[which]->GetVSize());
+      }
     }
 
     void Mult(const mfem::Vector& x, mfem::Vector& y) const { form_.GradientMult(x, y); }
 
-    double operator()(const mfem::Vector& x) const { return form_.ActionOfGradient(x, which_argument); }
+    qoi_type operator()(const mfem::Vector& x) const { return form_.ActionOfGradient(x, which_argument); }
 
-    std::unique_ptr<mfem::HypreParVector> assemble()
+    /**
+     * @brief assembles the gradient of each quantity of interest into a T-vector, from a single pass over
+     * the element gradients
+     *
+     * @return the gradient, or an array with the gradient of each of the quantities of interest
+     */
+    auto assemble()
     {
-      std::unique_ptr<mfem::HypreParVector> gradient_T(form_.trial_space_[which_argument]->NewTrueDofVector());
+      std::array<std::unique_ptr<mfem::HypreParVector>, num_qoi> gradient_T;
 
-      gradient_L_ = 0.0;
+      for (auto& gradient_L : gradient_L_) {
+        gradient_L = 0.0;
+      }
 
       if (form_.domain_integrals_.size() > 0) {
         auto& K_elem = form_.element_gradients_[which_argument];
@@ -430,7 +496,9 @@ private:
         for (axom::IndexType e = 0; e < K_elem.shape()[0]; e++) {
           for (axom::IndexType j = 0; j < K_elem.shape()[2]; j++) {
             auto [index, sign] = LUT(e, j);
-            gradient_L_[index] += sign * K_elem(e, 0, j);
+            for (axom::IndexType i = 0; i < num_qoi; i++) {
+              gradient_L_[static_cast<std::size_t>(i)][index] += sign * K_elem(e, i, j);
+            }
           }
         }
       }
@@ -447,14 +515,23 @@ private:
         for (axom::IndexType e = 0; e < K_belem.shape()[0]; e++) {
           for (axom::IndexType j = 0; j < K_belem.shape()[2]; j++) {
             auto [index, sign] = LUT(e, j);
-            gradient_L_[index] += sign * K_belem(e, 0, j);
+            for (axom::IndexType i = 0; i < num_qoi; i++) {
+              gradient_L_[static_cast<std::size_t>(i)][index] += sign * K_belem(e, i, j);
+            }
           }
         }
       }
 
-      form_.P_trial_[which_argument]->MultTranspose(gradient_L_, *gradient_T);
+      for (std::size_t i = 0; i < num_qoi; i++) {
+        gradient_T[i].reset(form_.trial_space_[which_argument]->NewTrueDofVector());
+        form_.P_trial_[which_argument]->MultTranspose(gradient_L_[i], *gradient_T[i]);
+      }
 
-      return gradient_T;
+      if constexpr (num_qoi == 1) {
+        return std::move(gradient_T[0]);
+      } else {
+        return gradient_T;
+      }
     }
 
     friend auto assemble(Gradient& g) { return g.assemble(); }
@@ -463,13 +540,14 @@ private:
     /**
      * @brief The "parent" @p Functional to calculate gradients with
      */
-    Functional<double(trials...), exec>& form_;
+    QoIFunctional<qoi_type(trials...), exec>& form_;
 
     DofNumbering lookup_tables;
 
     uint32_t which_argument;
 
-    mfem::Vector gradient_L_;
+    /// @brief the local (L-vector) gradient of each quantity of interest
+    std::array<mfem::Vector, num_qoi> gradient_L_;
   };
 
   /// @brief The input set of local DOF values (i.e., on the current rank)
@@ -559,4 +637,38 @@ private:
   std::array<ExecArray<double, 3, exec>, num_trial_spaces> bdr_element_gradients_;
 };
 
+/**
+ * @brief a partial template specialization of Functional with test == double, implying "quantity of interest"
+ */
+template <typename... trials, ExecutionSpace exec>
+class Functional<double(trials...), exec> : public QoIFunctional<double(trials...), exec> {
+public:
+  using QoIFunctional<double(trials...), exec>::QoIFunctional;
+};
+
+/**
+ * @brief a partial template specialization of Functional with test == tensor<double, n>, implying `n` quantities
+ * of interest that are integrated in a single pass over the mesh and summed across processors with a single
+ * reduction. Their gradients w.r.t. each argument are assembled together, into an array of `n` T-vectors.
+ *
+ * @code{.cpp}
+ * Functional<tensor<double, 2>(H1<1>)> f({&fespace});
+ * f.AddVolumeIntegral([](auto x, auto temperature) {
+ *   auto [u, du_dx] = temperature;
+ *   return tensor{{u, u * u}};
+ * }, mesh);
+ * auto [qoi, dqoi_dT] = f(differentiate_wrt(T));
+ * std::array<std::unique_ptr<mfem::HypreParVector>, 2> gradients = assemble(dqoi_dT);
+ * @endcode
+ *
+ * @note a single quantity of interest is represented as a double, so n must be at least 2
+ */
+template <int n, typename... trials, ExecutionSpace exec>
+class Functional<tensor<double, n>(trials...), exec> : public QoIFunctional<tensor<double, n>(trials...), exec> {
+  static_assert(n > 1, "Error: a single quantity of interest must be declared as Functional<double(trials...)>");
+
+public:
+  using QoIFunctional<tensor<double, n>(trials...), exec>::QoIFunctional;
+};
+
 }  // namespace serac
@@ -22,6 +22,65 @@
 
 namespace serac {
 
+/**
+ * @brief the value of `which_trial_space` that requests the derivatives w.r.t. every trial space of an integral
+ * from a single evaluation
+ */
+constexpr int all_trial_spaces = -2;
+
+/**
+ * @brief the largest number of trial spaces that can be differentiated in a single evaluation, limited by
+ * the number of entries in a `serac::tuple` (each trial space takes two entries of the gradient)
+ */
+constexpr int max_trial_spaces_per_evaluation = 4;
+
+/**
+ * @brief a q-function marked with `single_pass_derivatives`, which forwards every call to the q-function
+ * @tparam lambda the type of the q-function
+ */
+template <typename lambda>
+struct SinglePassIntegrand {
+  /// the q-function
+  lambda integrand;
+
+  /// @brief evaluates the q-function
+  template <typename... T>
+  auto operator()(T&&... args) const -> decltype(integrand(std::forward<T>(args)...))
+  {
+    return integrand(std::forward<T>(args)...);
+  }
+};
+
+/**
+ * @brief marks a q-function so that its integral also compiles the kernel that differentiates it w.r.t. every
+ * trial space in a single pass
+ *
+ * Differentiating a Functional w.r.t. several arguments at once, e.g. f(differentiate_wrt(u), differentiate_wrt(p)),
+ * evaluates the integrals that are not marked once per trial space instead. The single-pass kernel instantiates the
+ * q-function with dual numbers w.r.t. every argument, so it is only compiled for the integrals that ask for it.
+ *
+ * @code{.cpp}
+ * f.AddDomainIntegral(Dimension<2>{}, single_pass_derivatives([](auto x, auto u, auto p) { ... }), mesh);
+ * @endcode
+ *
+ * @param integrand the q-function
+ */
+template <typename lambda>
+auto single_pass_derivatives(lambda&& integrand)
+{
+  return SinglePassIntegrand<std::decay_t<lambda>>{std::forward<lambda>(integrand)};
+}
+
+/// @brief whether a q-function was marked with `single_pass_derivatives`
+template <typename T>
+struct is_single_pass_integrand : std::false_type {
+};
+
+/// @overload
+template <typename lambda>
+struct is_single_pass_integrand<SinglePassIntegrand<lambda>> : std::true_type {
+};
+
 namespace detail {
 
 /**
@@ -112,6 +171,18 @@ SERAC_HOST_DEVICE auto Load(const T& u, int e)
  */
 void Add(const mfem::DeviceTensor<2, double>& r_global, double r_local, int e) { r_global(0, e) += r_local; }
 
+/**
+ * @overload
+ * @note Used for several quantities of interest integrated together
+ */
+template <int n>
+SERAC_HOST_DEVICE void Add(const mfem::DeviceTensor<3, double>& r_global, tensor<double, n> r_local, int e)
+{
+  for (int i = 0; i < n; i++) {
+    AtomicAdd(r_global(0, i, e), r_local[i]);
+  }
+}
+
 /**
  * @brief Adds the contributions of the local residual to the global residual
  * @param[inout] r_global The full element-decomposed residual
@@ -1613,6 +1613,79 @@ SERAC_HOST_DEVICE auto chain_rule(const tensor<double, m, n, p...>& df_dx, const
   return total;
 }
 
+/**
+ * @brief evaluate the (first order) change in the input argument, dx, that a given change in the output, df, is
+ * sensitive to, i.e. the transpose of chain_rule(): dx = transpose(df_dx) * df
+ */
+SERAC_HOST_DEVICE constexpr auto transposed_chain_rule(const zero /* df_dx */, const zero /* df */) { return zero{}; }
+
+/**
+ * @overload
+ * @note this overload implements a no-op for the case where the gradient w.r.t. an input argument is identically zero
+ */
+template <typename T>
+SERAC_HOST_DEVICE constexpr auto transposed_chain_rule(const zero /* df_dx */, const T /* df */)
+{
+  return zero{};
+}
+
+/**
+ * @overload
+ * @note this overload implements a no-op for the case where the change in the output is indentically zero
+ */
+template <typename T>
+SERAC_HOST_DEVICE constexpr auto transposed_chain_rule(const T /* df_dx */, const zero /* df */)
+{
+  return zero{};
+}
+
+/**
+ * @overload
+ * @note for a scalar-valued function of a scalar, the transpose is just multiplication
+ */
+SERAC_HOST_DEVICE constexpr auto transposed_chain_rule(const double df_dx, const double df) { return df_dx * df; }
+
+/**
+ * @overload
+ * @note for a scalar-valued function of a tensor, the transpose is just scalar multiplication
+ */
+template <int... n>
+SERAC_HOST_DEVICE constexpr auto transposed_chain_rule(const tensor<double, n...>& df_dx, const double df)
+{
+  return df_dx * df;
+}
+
+/**
+ * @overload
+ * @note for a vector-valued function, the transpose contracts over the first index of df_dx
+ */
+template <int m, int... n>
+SERAC_HOST_DEVICE constexpr auto transposed_chain_rule(const tensor<double, m, n...>& df_dx,
+                                                       const tensor<double, m>&       df)
+{
+  decltype(df_dx[0] * df[0]) total{};
+  for (int i = 0; i < m; i++) {
+    total += df_dx[i] * df[i];
+  }
+  return total;
+}
+
+/**
+ * @overload
+ * @note for a matrix-valued function, the transpose contracts over the first two indices of df_dx
+ */
+template <int m, int n, int... p>
+SERAC_HOST_DEVICE auto transposed_chain_rule(const tensor<double, m, n, p...>& df_dx, const tensor<double, m, n>& df)
+{
+  decltype(df_dx[0][0] * df[0][0]) total{};
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      total += df_dx[i][j] * df[i][j];
+    }
+  }
+  return total;
+}
+
 }  // namespace serac
 
 #include "serac/numerics/functional/isotropic_tensor.hpp"
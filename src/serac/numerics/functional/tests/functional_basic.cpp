@@ -99,6 +99,63 @@ TEST(basic, nonlinear_thermal_test_3D)
   check_gradient(residual, U);
 }
 
+TEST(basic, linear_combination_of_gradients_2D)
+{
+  constexpr auto p   = 2;
+  constexpr auto dim = 2;
+
+  std::string meshfile = SERAC_REPO_DIR "/data/meshes/star.mesh";
+  auto        mesh2D   = mesh::refineAndDistribute(buildMeshFromFile(meshfile), 1, 0);
+
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fespace(mesh2D.get(), &fec);
+
+  mfem::Vector U(fespace.TrueVSize());
+  U.Randomize();
+
+  using test_space  = H1<p>;
+  using trial_space = H1<p>;
+
+  Functional<test_space(trial_space)> mass(&fespace, {&fespace});
+  mass.AddDomainIntegral(
+      Dimension<dim>{},
+      [=](auto, auto temperature) {
+        auto [u, du_dx] = temperature;
+        return serac::tuple{2.0 * u, 0.0 * du_dx};
+      },
+      *mesh2D);
+
+  Functional<test_space(trial_space)> stiffness(&fespace, {&fespace});
+  stiffness.AddDomainIntegral(
+      Dimension<dim>{},
+      [=](auto x, auto temperature) {
+        auto [u, du_dx] = temperature;
+        return serac::tuple{u * u - x[0], (1.0 + u * u) * du_dx};
+      },
+      *mesh2D);
+
+  constexpr double alpha = 1.5;
+  constexpr double beta  = 0.25;
+
+  auto [m, dmdU] = mass(differentiate_wrt(U));
+  auto [k, dkdU] = stiffness(differentiate_wrt(U));
+
+  std::unique_ptr<mfem::HypreParMatrix> M(assemble(dmdU));
+  std::unique_ptr<mfem::HypreParMatrix> K(assemble(dkdU));
+  std::unique_ptr<mfem::HypreParMatrix> reference(mfem::Add(alpha, *M, beta, *K));
+
+  // the linear combination is formed in a single pass over the shared sparsity pattern
+  std::unique_ptr<mfem::HypreParMatrix> combination = assemble(alpha, dmdU, beta, dkdU);
+
+  mfem::Vector dU(U.Size());
+  dU.Randomize(42);
+
+  mfem::Vector df1 = (*reference) * dU;
+  mfem::Vector df2 = (*combination) * dU;
+
+  EXPECT_NEAR(0., df1.DistanceTo(df2) / df1.Norml2(), 1.e-12);
+}
+
 int main(int argc, char* argv[])
 {
   int num_procs, myid;
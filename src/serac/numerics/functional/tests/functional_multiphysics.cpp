@@ -82,10 +82,40 @@ void check_gradient(Functional<T>& f, mfem::Vector& U, mfem::Vector& dU_dt)
 
     EXPECT_NEAR(0., relative_error1, 5.e-5);
     EXPECT_NEAR(0., relative_error2, 5.e-5);
+
+    // vector-Jacobian products w.r.t. the second argument, as used for sensitivities, should not need the matrix
+    mfem::Vector lambda(df1.Size());
+    lambda.Randomize(seed + 2);
+
+    mfem::Vector vjp1(dU_dt.Size());
+    df_ddU_dt.MultTranspose(lambda, vjp1);
+
+    mfem::Vector vjp2(dU_dt.Size());
+    df_ddU_dt_matrix->MultTranspose(lambda, vjp2);
+
+    EXPECT_NEAR(0., vjp2.DistanceTo(vjp1) / vjp2.Norml2(), 1.e-10);
+  }
+
+  {
+    // differentiating w.r.t. both arguments in a single evaluation should agree with one argument at a time
+    auto [value1, dfdU] = f(differentiate_wrt(U), dU_dt);
+    mfem::Vector value  = value1;
+    mfem::Vector df1    = dfdU(dU);
+
+    auto [value2, df_ddU_dt] = f(U, differentiate_wrt(dU_dt));
+    mfem::Vector df2         = df_ddU_dt(ddU_dt);
+
+    auto [value3, dfdU_both, df_ddU_dt_both] = f(differentiate_wrt(U), differentiate_wrt(dU_dt));
+
+    EXPECT_NEAR(0., value.DistanceTo(value3) / value.Norml2(), 1.e-12);
+    EXPECT_NEAR(0., df1.DistanceTo(dfdU_both(dU)) / df1.Norml2(), 1.e-12);
+    EXPECT_NEAR(0., df2.DistanceTo(df_ddU_dt_both(ddU_dt)) / df2.Norml2(), 1.e-12);
   }
 }
 
-TEST(basic, nonlinear_thermal_test_3D)
+/// the q-functions of the residual are marked with single_pass_derivatives when `single_pass` is true
+template <bool single_pass>
+void nonlinear_thermal_test_3D()
 {
   int serial_refinement   = 0;
   int parallel_refinement = 0;
@@ -116,22 +146,31 @@ TEST(basic, nonlinear_thermal_test_3D)
   // Construct the new functional object using the known test and trial spaces
   Functional<test_space(trial_space, trial_space)> residual(&fespace, {&fespace, &fespace});
 
+  // differentiating w.r.t. both arguments evaluates the marked integrals once, and the others once per argument
+  auto mark = [](auto qf) {
+    if constexpr (single_pass) {
+      return single_pass_derivatives(qf);
+    } else {
+      return qf;
+    }
+  };
+
   residual.AddVolumeIntegral(
-      [=](auto x, auto temperature, auto dtemperature_dt) {
+      mark([=](auto x, auto temperature, auto dtemperature_dt) {
         auto [u, du_dx]      = temperature;
         auto [du_dt, unused] = dtemperature_dt;
         auto source          = rho * cp * du_dt * du_dt - (100 * x[0] * x[1]);
         auto flux            = kappa * du_dx;
         return serac::tuple{source, flux};
-      },
+      }),
       *mesh3D);
 
   residual.AddSurfaceIntegral(
-      [=](auto x, auto /*n*/, auto temperature, auto dtemperature_dt) {
+      mark([=](auto x, auto /*n*/, auto temperature, auto dtemperature_dt) {
         auto [u, _0]     = temperature;
         auto [du_dt, _1] = dtemperature_dt;
         return x[0] + x[1] - cos(u) * du_dt;
-      },
+      }),
       *mesh3D);
 
   mfem::Vector r = residual(U, dU_dt);
@@ -139,6 +178,9 @@ TEST(basic, nonlinear_thermal_test_3D)
   check_gradient(residual, U, dU_dt);
 }
 
+TEST(basic, nonlinear_thermal_test_3D) { nonlinear_thermal_test_3D<false>(); }
+TEST(basic, nonlinear_thermal_test_3D_single_pass) { nonlinear_thermal_test_3D<true>(); }
+
 int main(int argc, char* argv[])
 {
   int num_procs, myid;
@@ -76,7 +76,21 @@ void check_gradient(Functional<T>& f, mfem::Vector& U)
   EXPECT_NEAR(0., relative_error1, 5.e-6);
   EXPECT_NEAR(0., relative_error2, 5.e-6);
 
-  std::cout << relative_error1 << " " << relative_error2 << std::endl;
+  // the transposed action, computed by the element kernels, should agree with the transpose of the assembled matrix
+  mfem::Vector dF(df1.Size());
+  dF.Randomize(seed + 1);
+
+  mfem::Vector dU1(U.Size());
+  dfdU.MultTranspose(dF, dU1);
+
+  mfem::Vector dU2(U.Size());
+  dfdU_matrix->MultTranspose(dF, dU2);
+
+  double relative_error3 = dU2.DistanceTo(dU1) / dU2.Norml2();
+
+  EXPECT_NEAR(0., relative_error3, 1.e-10);
+
+  std::cout << relative_error1 << " " << relative_error2 << " " << relative_error3 << std::endl;
 }
 
 // this test sets up a toy "thermal" problem where the residual includes contributions
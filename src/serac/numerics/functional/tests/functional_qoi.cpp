@@ -188,6 +188,24 @@ void check_gradient(Functional<T>& f, mfem::HypreParVector& U, mfem::HypreParVec
     EXPECT_NEAR(0., relative_error2, 1.e-2);
     EXPECT_NEAR(0., relative_error3, 5.e-14);
   }
+
+  {
+    // differentiating w.r.t. both arguments in one call should agree with one argument at a time
+    auto [value1, dfdU]      = f(differentiate_wrt(U), dU_dt);
+    double df1               = dfdU(dU);
+    auto [value2, df_ddU_dt] = f(U, differentiate_wrt(dU_dt));
+    double df2               = df_ddU_dt(ddU_dt);
+
+    auto [value, dfdU_both, df_ddU_dt_both] = f(differentiate_wrt(U), differentiate_wrt(dU_dt));
+
+    EXPECT_NEAR(0., fabs(value - value1) / fabs(value1), 1.e-12);
+    EXPECT_NEAR(0., fabs(value - value2) / fabs(value2), 1.e-12);
+    EXPECT_NEAR(0., fabs(dfdU_both(dU) - df1) / fabs(df1), 1.e-12);
+    EXPECT_NEAR(0., fabs(df_ddU_dt_both(ddU_dt) - df2) / fabs(df2), 1.e-12);
+
+    std::unique_ptr<mfem::HypreParVector> dfdU_vector = assemble(dfdU_both);
+    EXPECT_NEAR(0., fabs(mfem::InnerProduct(*dfdU_vector, dU) - df1) / fabs(df1), 1.e-12);
+  }
 }
 
 enum class WhichTest
@@ -320,14 +338,16 @@ void qoi_test(mfem::ParMesh& mesh, H1<p1> trial1, H1<p2> trial2, Dimension<dim>)
   using trial_space1 = decltype(trial1);
   using trial_space2 = decltype(trial2);
 
+  // the domain integral is differentiated w.r.t. both arguments in a single pass, and the boundary integral
+  // one argument at a time
   Functional<double(trial_space1, trial_space2)> f({&fespace1, &fespace2});
   f.AddDomainIntegral(
       Dimension<dim>{},
-      [&](auto x, auto temperature, auto dtemperature_dt) {
+      single_pass_derivatives([&](auto x, auto temperature, auto dtemperature_dt) {
         auto [u, grad_u]     = temperature;
         auto [du_dt, unused] = dtemperature_dt;
         return x[0] * x[0] + sin(du_dt) + x[0] * u * u * u;
-      },
+      }),
       mesh);
   f.AddBoundaryIntegral(
       Dimension<dim - 1>{},
@@ -355,6 +375,77 @@ void qoi_test(mfem::ParMesh& mesh, H1<p1> trial1, H1<p2> trial2, Dimension<dim>)
   check_gradient(f, U1, U2);
 }
 
+template <int p, int dim>
+void batched_qoi_test(mfem::ParMesh& mesh, H1<p> trial, Dimension<dim>)
+{
+  auto                        fec = mfem::H1_FECollection(p, dim);
+  mfem::ParFiniteElementSpace fespace(&mesh, &fec);
+
+  mfem::ParGridFunction     U_gf(&fespace);
+  mfem::FunctionCoefficient x_squared([](mfem::Vector x) { return x[0] * x[0]; });
+  U_gf.ProjectCoefficient(x_squared);
+
+  std::unique_ptr<mfem::HypreParVector> tmp(fespace.NewTrueDofVector());
+  mfem::HypreParVector                  U = *tmp;
+  U_gf.GetTrueDofs(U);
+
+  using trial_space = decltype(trial);
+
+  auto g0 = [](auto x, auto temperature) {
+    auto [u, grad_u] = temperature;
+    return x[0] * x[0] + x[0] * u * u * u;
+  };
+  auto g1 = [](auto /*x*/, auto temperature) {
+    auto [u, grad_u] = temperature;
+    return u * u + dot(grad_u, grad_u);
+  };
+  auto h1 = [](auto x, auto /*n*/, auto temperature) {
+    auto [u, unused] = temperature;
+    return cos(u * x[1]);
+  };
+
+  // two quantities of interest, integrated together in one pass over the mesh
+  Functional<tensor<double, 2>(trial_space)> f({&fespace});
+  f.AddDomainIntegral(
+      Dimension<dim>{}, [&](auto x, auto temperature) { return tensor{{g0(x, temperature), g1(x, temperature)}}; },
+      mesh);
+  f.AddBoundaryIntegral(
+      Dimension<dim - 1>{},
+      [&](auto x, auto n, auto temperature) { return tensor{{0.0 * h1(x, n, temperature), h1(x, n, temperature)}}; },
+      mesh);
+
+  // and the same quantities of interest, integrated separately
+  Functional<double(trial_space)> f0({&fespace});
+  f0.AddDomainIntegral(Dimension<dim>{}, g0, mesh);
+
+  Functional<double(trial_space)> f1({&fespace});
+  f1.AddDomainIntegral(Dimension<dim>{}, g1, mesh);
+  f1.AddBoundaryIntegral(Dimension<dim - 1>{}, h1, mesh);
+
+  tensor<double, 2> values = f(U);
+  EXPECT_NEAR(0.0, (values[0] - f0(U)) / f0(U), 1.0e-12);
+  EXPECT_NEAR(0.0, (values[1] - f1(U)) / f1(U), 1.0e-12);
+
+  auto [unused, df_dU] = f(differentiate_wrt(U));
+  auto [unused0, df0_dU] = f0(differentiate_wrt(U));
+  auto [unused1, df1_dU] = f1(differentiate_wrt(U));
+
+  std::array<std::unique_ptr<mfem::HypreParVector>, 2> df_dU_vecs = assemble(df_dU);
+  std::unique_ptr<mfem::HypreParVector>                df0_dU_vec = assemble(df0_dU);
+  std::unique_ptr<mfem::HypreParVector>                df1_dU_vec = assemble(df1_dU);
+
+  EXPECT_NEAR(0.0, df_dU_vecs[0]->DistanceTo(*df0_dU_vec) / df0_dU_vec->Norml2(), 1.0e-12);
+  EXPECT_NEAR(0.0, df_dU_vecs[1]->DistanceTo(*df1_dU_vec) / df1_dU_vec->Norml2(), 1.0e-12);
+
+  mfem::HypreParVector dU = U;
+  dU                      = U;
+  dU.Randomize(42);
+
+  tensor<double, 2> df = df_dU(dU);
+  EXPECT_NEAR(0.0, (df[0] - df0_dU(dU)) / df0_dU(dU), 1.0e-12);
+  EXPECT_NEAR(0.0, (df[1] - df1_dU(dU)) / df1_dU(dU), 1.0e-12);
+}
+
 // clang-format off
 TEST(measure, 2D_linear   ) { qoi_test(*mesh2D, H1<1>{}, Dimension<2>{}, WhichTest::Measure); }
 TEST(measure, 2D_quadratic) { qoi_test(*mesh2D, H1<2>{}, Dimension<2>{}, WhichTest::Measure); }
@@ -380,6 +471,11 @@ TEST(variadic, 2D_linear   ) { qoi_test(*mesh2D, H1<1>{}, H1<1>{}, Dimension<2>{
 TEST(variadic, 2D_quadratic) { qoi_test(*mesh2D, H1<2>{}, H1<2>{}, Dimension<2>{}); }
 TEST(variadic, 3D_linear   ) { qoi_test(*mesh3D, H1<1>{}, H1<1>{}, Dimension<3>{}); }
 TEST(variadic, 3D_quadratic) { qoi_test(*mesh3D, H1<2>{}, H1<2>{}, Dimension<3>{}); }
+
+TEST(batched, 2D_linear   ) { batched_qoi_test(*mesh2D, H1<1>{}, Dimension<2>{}); }
+TEST(batched, 2D_quadratic) { batched_qoi_test(*mesh2D, H1<2>{}, Dimension<2>{}); }
+TEST(batched, 3D_linear   ) { batched_qoi_test(*mesh3D, H1<1>{}, Dimension<3>{}); }
+TEST(batched, 3D_quadratic) { batched_qoi_test(*mesh3D, H1<2>{}, Dimension<3>{}); }
 // clang-format on
 
 int main(int argc, char* argv[])
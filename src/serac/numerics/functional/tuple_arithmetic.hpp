@@ -238,6 +238,49 @@ constexpr auto make_dual_wrt(const serac::tuple<T...>& args)
   return make_dual_helper<n>(args, std::make_integer_sequence<int, int(sizeof...(T))>{});
 }
 
+/// @brief layer of indirection required to implement `make_dual_wrt_all`
+template <typename... T, int... i>
+SERAC_HOST_DEVICE constexpr auto make_dual_wrt_all_helper(const serac::tuple<T...>& args,
+                                                          std::integer_sequence<int, i...>)
+{
+  constexpr int N = 2 * int(sizeof...(T));
+  return serac::make_tuple(serac::tuple{make_dual_helper<2 * i, N>(serac::get<0>(serac::get<i>(args))),
+                                        make_dual_helper<2 * i + 1, N>(serac::get<1>(serac::get<i>(args)))}...);
+}
+
+/**
+ * @tparam T the types of the values in the tuple, each a pair of a value and its derivative (or zero)
+ *
+ * @brief take a tuple of q-function arguments, and promote all of them to dual numbers with a block-structured
+ * gradient type: the two components of the `n`th argument are tracked by gradient entries `2n` and `2n + 1`
+ * @param args the values to be promoted
+ *
+ * @note the derivatives w.r.t. each argument can be recovered with `assign_gradient_block`
+ */
+template <typename... T>
+constexpr auto make_dual_wrt_all(const serac::tuple<T...>& args)
+{
+  return make_dual_wrt_all_helper(args, std::make_integer_sequence<int, int(sizeof...(T))>{});
+}
+
+/**
+ * @tparam k the index of the q-function argument
+ * @tparam S the derivative type of the q-function output when evaluated with `make_dual_wrt<k>`
+ * @tparam T the gradient type of the q-function output when evaluated with `make_dual_wrt_all`
+ *
+ * @brief extract the derivatives of a q-function output w.r.t. its `k`th argument from a block-structured gradient
+ * @param[out] derivative the derivatives w.r.t. argument `k`, in the layout of a `make_dual_wrt<k>` evaluation
+ * @param[in] gradient the derivatives w.r.t. every argument
+ */
+template <int k, typename S, typename T>
+SERAC_HOST_DEVICE void assign_gradient_block(S& derivative, const T& gradient)
+{
+  if constexpr (!is_zero<S>{}) {
+    serac::get<0>(derivative) = serac::get<2 * k>(gradient);
+    serac::get<1>(derivative) = serac::get<2 * k + 1>(gradient);
+  }
+}
+
 /**
  * @brief Retrieves the value components of a set of (possibly dual) numbers
  * @param[in] tuple_of_values The tuple of numbers to retrieve values from
@@ -0,0 +1,503 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/krylov_solvers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac::mfem_ext {
+
+namespace {
+
+/**
+ * @brief Sums local values over all ranks without blocking, so local work can proceed until the sum is needed
+ */
+class NonblockingSum {
+public:
+  /**
+   * @brief Starts the reduction, which is done in place
+   * @param[in] comm The communicator, or MPI_COMM_NULL for a serial solve
+   * @param[inout] values The local values, overwritten with the global sums once Wait returns
+   * @param[in] count The number of values
+   */
+  void Start(MPI_Comm comm, double* values, int count)
+  {
+    active_ = (comm != MPI_COMM_NULL);
+    if (active_) {
+      MPI_Iallreduce(MPI_IN_PLACE, values, count, MPI_DOUBLE, MPI_SUM, comm, &request_);
+    }
+  }
+
+  /// @brief Waits for the reduction to complete
+  void Wait()
+  {
+    if (active_) {
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+      active_ = false;
+    }
+  }
+
+private:
+  /// @brief The handle of the pending reduction
+  MPI_Request request_ = MPI_REQUEST_NULL;
+
+  /// @brief Whether a reduction is pending
+  bool active_ = false;
+};
+
+/// @brief z = M r, or z = r without a preconditioner
+void ApplyPreconditioner(const mfem::Solver* prec, const mfem::Vector& r, mfem::Vector& z)
+{
+  if (prec) {
+    prec->Mult(r, z);
+  } else {
+    z = r;
+  }
+}
+
+/**
+ * @brief Solves G a = g for a symmetric positive (semi-)definite matrix with a diagonally scaled Cholesky
+ * factorization, truncated at the first numerically vanishing pivot
+ * @param[in] G The matrix
+ * @param[in] g The right hand side
+ * @param[out] a The solution of the leading (rank x rank) system
+ * @return The rank of the leading block that was solved
+ */
+int TruncatedCholeskySolve(const mfem::DenseMatrix& G, const mfem::Vector& g, mfem::Vector& a)
+{
+  constexpr double pivot_tolerance = 1.0e-14;
+
+  const int    k = G.Height();
+  mfem::Vector scale(k);
+  int          rank = k;
+  for (int i = 0; i < k; i++) {
+    if (G(i, i) <= 0.0) {
+      rank = i;
+      break;
+    }
+    scale(i) = 1.0 / std::sqrt(G(i, i));
+  }
+
+  mfem::DenseMatrix L(k);
+  L = 0.0;
+  for (int j = 0; j < rank; j++) {
+    double pivot = G(j, j) * scale(j) * scale(j);
+    for (int l = 0; l < j; l++) {
+      pivot -= L(j, l) * L(j, l);
+    }
+    if (pivot <= pivot_tolerance) {
+      rank = j;
+      break;
+    }
+    L(j, j) = std::sqrt(pivot);
+    for (int i = j + 1; i < rank; i++) {
+      double value = G(i, j) * scale(i) * scale(j);
+      for (int l = 0; l < j; l++) {
+        value -= L(i, l) * L(j, l);
+      }
+      L(i, j) = value / L(j, j);
+    }
+  }
+
+  // forward and backward substitution with the scaled factor
+  a.SetSize(rank);
+  for (int i = 0; i < rank; i++) {
+    double value = g(i) * scale(i);
+    for (int l = 0; l < i; l++) {
+      value -= L(i, l) * a(l);
+    }
+    a(i) = value / L(i, i);
+  }
+  for (int i = rank - 1; i >= 0; i--) {
+    double value = a(i);
+    for (int l = i + 1; l < rank; l++) {
+      value -= L(l, i) * a(l);
+    }
+    a(i) = value / L(i, i);
+  }
+  for (int i = 0; i < rank; i++) {
+    a(i) *= scale(i);
+  }
+  return rank;
+}
+
+}  // namespace
+
+void PipelinedCGSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(!oper, "The operator must be set before solving");
+
+  for (auto v : {&r_, &u_, &w_, &m_, &n_, &z_, &q_, &s_, &p_}) {
+    v->SetSize(height);
+  }
+
+  if (!iterative_mode) {
+    x = 0.0;
+  }
+
+  oper->Mult(x, r_);
+  subtract(b, r_, r_);
+  ApplyPreconditioner(prec, r_, u_);
+  oper->Mult(u_, w_);
+
+  z_ = 0.0;
+  q_ = 0.0;
+  s_ = 0.0;
+  p_ = 0.0;
+
+  NonblockingSum sum;
+  double         dots[2];
+  double         gamma     = 0.0;
+  double         gamma_old = 0.0;
+  double         alpha     = 0.0;
+  double         goal      = 0.0;
+
+  converged = 0;
+  int i;
+  for (i = 0; true; i++) {
+    dots[0] = r_ * u_;
+    dots[1] = w_ * u_;
+    sum.Start(comm, dots, 2);
+
+    // overlap the reduction with the preconditioner and operator applications of this iteration
+    ApplyPreconditioner(prec, w_, m_);
+    oper->Mult(m_, n_);
+
+    sum.Wait();
+    gamma              = dots[0];
+    const double delta = dots[1];
+
+    if (i == 0) {
+      goal = std::max(rel_tol * rel_tol * gamma, abs_tol * abs_tol);
+    }
+    if (print_level == 1) {
+      mfem::out << "   Iteration : " << std::setw(3) << i << "  (B r, r) = " << gamma << '\n';
+    }
+    if (gamma <= goal) {
+      converged = 1;
+      break;
+    }
+    if (!std::isfinite(gamma) || gamma < 0.0 || i >= max_iter) {
+      break;
+    }
+
+    const double beta = (i > 0) ? gamma / gamma_old : 0.0;
+    alpha             = (i > 0) ? gamma / (delta - beta * gamma / alpha) : gamma / delta;
+
+    add(n_, beta, z_, z_);
+    add(m_, beta, q_, q_);
+    add(w_, beta, s_, s_);
+    add(u_, beta, p_, p_);
+
+    x.Add(alpha, p_);
+    r_.Add(-alpha, s_);
+    u_.Add(-alpha, q_);
+    w_.Add(-alpha, z_);
+
+    gamma_old = gamma;
+  }
+
+  SLIC_WARNING_ROOT_IF(!converged && print_level >= 0, "Pipelined CG did not converge");
+  final_iter = i;
+  final_norm = std::sqrt(std::max(gamma, 0.0));
+}
+
+void PipelinedGMRESSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(!oper, "The operator must be set before solving");
+
+  // when the Gram-Schmidt norm has lost more than half its digits to cancellation, it is recomputed directly
+  constexpr double cancellation_tolerance = 1.0e-8;
+
+  const int m = restart_;
+  V_.resize(static_cast<std::size_t>(m + 1));
+  Z_.resize(static_cast<std::size_t>(m + 1));
+  for (auto v : {&r_, &t_, &q_}) {
+    v->SetSize(height);
+  }
+
+  if (!iterative_mode) {
+    x = 0.0;
+  }
+
+  mfem::DenseMatrix   H(m + 1, m);
+  mfem::Vector        cs(m), sn(m), g(m + 1), y(m);
+  std::vector<double> dots(static_cast<std::size_t>(m + 2));
+  NonblockingSum      sum;
+
+  double goal  = 0.0;
+  double resid = 0.0;
+  int    it    = 0;
+  converged    = 0;
+
+  for (bool first_cycle = true; true; first_cycle = false) {
+    // the true residual replaces the recurrence at every restart
+    oper->Mult(x, r_);
+    subtract(b, r_, r_);
+    const double beta = Norm(r_);
+    if (first_cycle) {
+      goal = std::max(rel_tol * beta, abs_tol);
+    }
+    resid = beta;
+    if (beta <= goal) {
+      converged = 1;
+      break;
+    }
+    if (it >= max_iter) {
+      break;
+    }
+
+    auto& v0 = V_[0];
+    v0.SetSize(height);
+    v0.Set(1.0 / beta, r_);
+    Z_[0].SetSize(height);
+    ApplyPreconditioner(prec, v0, t_);
+    oper->Mult(t_, Z_[0]);
+
+    g    = 0.0;
+    g(0) = beta;
+
+    int j = 0;
+    while (j < m && it < max_iter) {
+      auto&       v_new = V_[static_cast<std::size_t>(j + 1)];
+      auto&       z_new = Z_[static_cast<std::size_t>(j + 1)];
+      const auto& z     = Z_[static_cast<std::size_t>(j)];
+
+      // the Hessenberg column and the norm of the new vector in a single reduction
+      for (int i = 0; i <= j; i++) {
+        dots[static_cast<std::size_t>(i)] = V_[static_cast<std::size_t>(i)] * z;
+      }
+      dots[static_cast<std::size_t>(j + 1)] = z * z;
+      sum.Start(comm, dots.data(), j + 2);
+
+      // overlap the reduction with the next preconditioner and operator applications
+      ApplyPreconditioner(prec, z, t_);
+      oper->Mult(t_, q_);
+
+      sum.Wait();
+      const double z_norm2 = dots[static_cast<std::size_t>(j + 1)];
+      double       norm2   = z_norm2;
+      v_new.SetSize(height);
+      v_new = z;
+      for (int i = 0; i <= j; i++) {
+        H(i, j) = dots[static_cast<std::size_t>(i)];
+        norm2 -= H(i, j) * H(i, j);
+        v_new.Add(-H(i, j), V_[static_cast<std::size_t>(i)]);
+      }
+      if (norm2 <= cancellation_tolerance * z_norm2) {
+        norm2 = Dot(v_new, v_new);
+      }
+      const double h = std::sqrt(std::max(norm2, 0.0));
+      H(j + 1, j)    = h;
+
+      // A M v_new follows from the recurrence of the basis
+      if (h > 0.0) {
+        v_new /= h;
+        z_new.SetSize(height);
+        z_new = q_;
+        for (int i = 0; i <= j; i++) {
+          z_new.Add(-H(i, j), Z_[static_cast<std::size_t>(i)]);
+        }
+        z_new /= h;
+      }
+
+      // Givens rotations reduce the Hessenberg matrix to upper triangular form
+      for (int i = 0; i < j; i++) {
+        const double temp = cs(i) * H(i, j) + sn(i) * H(i + 1, j);
+        H(i + 1, j)       = -sn(i) * H(i, j) + cs(i) * H(i + 1, j);
+        H(i, j)           = temp;
+      }
+      const double denominator = std::hypot(H(j, j), H(j + 1, j));
+      cs(j)                    = H(j, j) / denominator;
+      sn(j)                    = H(j + 1, j) / denominator;
+      H(j, j)                  = denominator;
+      H(j + 1, j)              = 0.0;
+      g(j + 1)                 = -sn(j) * g(j);
+      g(j)                     = cs(j) * g(j);
+
+      it++;
+      j++;
+      resid = std::abs(g(j));
+      if (print_level == 1) {
+        mfem::out << "   Pass : " << std::setw(2) << (it - 1) / m + 1 << "   Iteration : " << std::setw(3) << it
+                  << "  ||r|| = " << resid << '\n';
+      }
+      if (resid <= goal || h == 0.0) {
+        break;
+      }
+    }
+
+    // x += M V y, where H y = g
+    for (int i = j - 1; i >= 0; i--) {
+      double value = g(i);
+      for (int l = i + 1; l < j; l++) {
+        value -= H(i, l) * y(l);
+      }
+      y(i) = value / H(i, i);
+    }
+    r_ = 0.0;
+    for (int i = 0; i < j; i++) {
+      r_.Add(y(i), V_[static_cast<std::size_t>(i)]);
+    }
+    ApplyPreconditioner(prec, r_, t_);
+    x += t_;
+  }
+
+  SLIC_WARNING_ROOT_IF(!converged && print_level >= 0, "Pipelined GMRES did not converge");
+  final_iter = it;
+  final_norm = resid;
+}
+
+SStepCGSolver::SStepCGSolver(MPI_Comm comm, int s) : mfem::IterativeSolver(comm), s_(s)
+{
+  SLIC_ERROR_ROOT_IF(s_ < 1, "The s-step block size must be positive");
+}
+
+void SStepCGSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(!oper, "The operator must be set before solving");
+
+  const auto s = static_cast<std::size_t>(s_);
+
+  r_.SetSize(height);
+  if (!iterative_mode) {
+    x = 0.0;
+  }
+  oper->Mult(x, r_);
+  subtract(b, r_, r_);
+
+  Q_.clear();
+  AQ_.clear();
+
+  mfem::DenseMatrix   C_raw, C, G(s_);
+  mfem::Vector        g(s_), a, column, coefficients;
+  std::vector<double> sums;
+
+  double rz   = 0.0;
+  double goal = 0.0;
+  int    it   = 0;
+  converged   = 0;
+
+  for (bool first_block = true; true; first_block = false) {
+    // the (preconditioned) monomial basis of the next s Krylov vectors
+    S_.resize(s);
+    AS_.resize(s);
+    for (std::size_t k = 0; k < s; k++) {
+      S_[k].SetSize(height);
+      AS_[k].SetSize(height);
+      ApplyPreconditioner(prec, (k == 0) ? r_ : AS_[k - 1], S_[k]);
+      oper->Mult(S_[k], AS_[k]);
+    }
+
+    // all of the block's inner products in a single reduction:
+    // (A Q)^T S, S^T A S, and S^T r, whose first entry is (M r, r) for the convergence test
+    const auto kq = Q_.size();
+    sums.resize(kq * s + s * s + s);
+    auto value = sums.begin();
+    for (std::size_t i = 0; i < kq; i++) {
+      for (std::size_t j = 0; j < s; j++) {
+        *value++ = AQ_[i] * S_[j];
+      }
+    }
+    for (std::size_t i = 0; i < s; i++) {
+      for (std::size_t j = 0; j < s; j++) {
+        *value++ = S_[i] * AS_[j];
+      }
+    }
+    for (std::size_t i = 0; i < s; i++) {
+      *value++ = S_[i] * r_;
+    }
+    if (comm != MPI_COMM_NULL) {
+      MPI_Allreduce(MPI_IN_PLACE, sums.data(), static_cast<int>(sums.size()), MPI_DOUBLE, MPI_SUM, comm);
+    }
+
+    value = sums.begin();
+    C_raw.SetSize(static_cast<int>(kq), s_);
+    for (std::size_t i = 0; i < kq; i++) {
+      for (std::size_t j = 0; j < s; j++) {
+        C_raw(static_cast<int>(i), static_cast<int>(j)) = *value++;
+      }
+    }
+    for (int i = 0; i < s_; i++) {
+      for (int j = 0; j < s_; j++) {
+        G(i, j) = *value++;
+      }
+    }
+    for (int i = 0; i < s_; i++) {
+      g(i) = *value++;
+    }
+    rz = g(0);
+
+    if (first_block) {
+      goal = std::max(rel_tol * rel_tol * rz, abs_tol * abs_tol);
+    }
+    if (print_level == 1) {
+      mfem::out << "   Iteration : " << std::setw(3) << it << "  (B r, r) = " << rz << '\n';
+    }
+    if (rz <= goal) {
+      converged = 1;
+      break;
+    }
+    if (!std::isfinite(rz) || rz < 0.0 || it >= max_iter) {
+      break;
+    }
+
+    // A-conjugate the block to the previous one: S -= Q C, with C = (Q^T A Q)^{-1} (A Q)^T S
+    if (kq > 0) {
+      C.SetSize(static_cast<int>(kq), s_);
+      for (int j = 0; j < s_; j++) {
+        C_raw.GetColumn(j, column);
+        TruncatedCholeskySolve(QAQ_, column, coefficients);
+        C.SetCol(j, coefficients);
+      }
+      for (std::size_t j = 0; j < s; j++) {
+        for (std::size_t i = 0; i < kq; i++) {
+          const double c = C(static_cast<int>(i), static_cast<int>(j));
+          S_[j].Add(-c, Q_[i]);
+          AS_[j].Add(-c, AQ_[i]);
+        }
+      }
+      // S^T A S - C^T (Q^T A Q) C, where (Q^T A Q) C = (A Q)^T S
+      for (int i = 0; i < s_; i++) {
+        for (int j = 0; j < s_; j++) {
+          for (int l = 0; l < static_cast<int>(kq); l++) {
+            G(i, j) -= C_raw(l, i) * C(l, j);
+          }
+        }
+      }
+      // S^T r is unchanged, since r is orthogonal to the previous block
+    }
+    G.Symmetrize();
+
+    // minimize the energy norm of the error over the block
+    const int rank = TruncatedCholeskySolve(G, g, a);
+    for (int i = 0; i < rank; i++) {
+      x.Add(a(i), S_[static_cast<std::size_t>(i)]);
+      r_.Add(-a(i), AS_[static_cast<std::size_t>(i)]);
+    }
+    it += s_;
+    if (rank == 0) {
+      break;
+    }
+
+    // the (possibly truncated) block becomes the previous one
+    Q_.swap(S_);
+    AQ_.swap(AS_);
+    Q_.resize(static_cast<std::size_t>(rank));
+    AQ_.resize(static_cast<std::size_t>(rank));
+    QAQ_.CopyMN(G, rank, rank, 0, 0);
+  }
+
+  SLIC_WARNING_ROOT_IF(!converged && print_level >= 0, "s-step CG did not converge");
+  final_iter = it;
+  final_norm = std::sqrt(std::max(rz, 0.0));
+}
+
+}  // namespace serac::mfem_ext
@@ -0,0 +1,138 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file krylov_solvers.hpp
+ *
+ * @brief Krylov solvers that hide or batch the global reductions of CG and GMRES, for better strong scaling
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mfem.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief Preconditioned conjugate gradients with a single non-blocking global reduction per iteration, which is
+ * overlapped with the preconditioner and operator applications (Ghysels and Vanroose, 2014)
+ *
+ * The iterates are mathematically equivalent to those of mfem::CGSolver, which has two blocking reductions per
+ * iteration, and convergence is also measured in the preconditioned residual norm. The extra recurrences
+ * need four more vectors and make the method slightly less accurate in finite precision.
+ */
+class PipelinedCGSolver : public mfem::IterativeSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   */
+  explicit PipelinedCGSolver(MPI_Comm comm) : mfem::IterativeSolver(comm) {}
+
+  /**
+   * @brief Solves A x = b
+   * @param[in] b The right hand side
+   * @param[inout] x The solution, which is also the initial guess in iterative mode
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+private:
+  /// @brief Working vectors of the pipelined recurrences
+  mutable mfem::Vector r_, u_, w_, m_, n_, z_, q_, s_, p_;
+};
+
+/**
+ * @brief Restarted, right-preconditioned GMRES with one non-blocking global reduction per iteration, which is
+ * overlapped with the next preconditioner and operator application (a p(1)-GMRES variant)
+ *
+ * The orthogonalization coefficients and the norm of the new Krylov vector are computed from a single reduction
+ * with classical Gram-Schmidt, and the product of the operator with the new basis vector is obtained from the
+ * recurrence of the basis rather than a separate application. This stores the operator applied to the basis
+ * alongside the basis itself. When the norm suffers from severe cancellation, it is recomputed with a blocking
+ * reduction. Rounding errors in that recurrence grow with the cycle length, so the default restart is shorter
+ * than mfem::GMRESSolver's, and the true residual replaces the recurrence at each restart.
+ */
+class PipelinedGMRESSolver : public mfem::IterativeSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] restart The dimension of the Krylov space before a restart
+   */
+  explicit PipelinedGMRESSolver(MPI_Comm comm, int restart = 30) : mfem::IterativeSolver(comm), restart_(restart) {}
+
+  /**
+   * @brief Sets the dimension of the Krylov space before a restart
+   * @param[in] restart The restart length
+   */
+  void SetKDim(int restart) { restart_ = restart; }
+
+  /**
+   * @brief Solves A x = b
+   * @param[in] b The right hand side
+   * @param[inout] x The solution, which is also the initial guess in iterative mode
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+private:
+  /// @brief The dimension of the Krylov space before a restart
+  int restart_;
+
+  /// @brief The orthonormal Krylov basis, and the preconditioned operator applied to it
+  mutable std::vector<mfem::Vector> V_, Z_;
+
+  /// @brief Working vectors
+  mutable mfem::Vector r_, t_, q_;
+};
+
+/**
+ * @brief The s-step preconditioned conjugate gradient method, which generates s Krylov vectors at a time and
+ * computes all of their inner products in a single global reduction (Chronopoulos and Gear, 1989)
+ *
+ * Each block is made A-conjugate to the previous one, and the energy norm of the error is minimized over it,
+ * which in exact arithmetic reproduces s iterations of CG. The monomial basis becomes ill-conditioned for
+ * large s, so small blocks (s <= 5) are recommended; blocks that are numerically rank deficient are truncated.
+ * The reported number of iterations is the number of Krylov vectors generated.
+ */
+class SStepCGSolver : public mfem::IterativeSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] s The number of Krylov vectors generated per block
+   */
+  SStepCGSolver(MPI_Comm comm, int s);
+
+  /**
+   * @brief Solves A x = b
+   * @param[in] b The right hand side
+   * @param[inout] x The solution, which is also the initial guess in iterative mode
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+private:
+  /// @brief The number of Krylov vectors generated per block
+  int s_;
+
+  /// @brief The current block of search directions, and the operator applied to it
+  mutable std::vector<mfem::Vector> S_, AS_;
+
+  /// @brief The previous block of search directions, and the operator applied to it
+  mutable std::vector<mfem::Vector> Q_, AQ_;
+
+  /// @brief The Gram matrix Q^T A Q of the previous block
+  mutable mfem::DenseMatrix QAQ_;
+
+  /// @brief Working vectors
+  mutable mfem::Vector r_;
+};
+
+}  // namespace serac::mfem_ext
@@ -0,0 +1,214 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/mixed_precision.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac::mfem_ext {
+
+void SinglePrecisionParMatrix::Block::Assign(const mfem::SparseMatrix& block)
+{
+  const int rows = block.Height();
+  const int nnz  = block.NumNonZeroElems();
+  I.assign(block.GetI(), block.GetI() + rows + 1);
+  J.assign(block.GetJ(), block.GetJ() + nnz);
+  values.resize(static_cast<std::size_t>(nnz));
+  std::transform(block.GetData(), block.GetData() + nnz, values.begin(),
+                 [](double value) { return static_cast<float>(value); });
+}
+
+void SinglePrecisionParMatrix::Block::AddMult(const double* x, double* y) const
+{
+  const int rows = static_cast<int>(I.size()) - 1;
+  for (int i = 0; i < rows; i++) {
+    double sum = 0.0;
+    for (int k = I[static_cast<std::size_t>(i)]; k < I[static_cast<std::size_t>(i) + 1]; k++) {
+      sum += static_cast<double>(values[static_cast<std::size_t>(k)]) * x[J[static_cast<std::size_t>(k)]];
+    }
+    y[i] += sum;
+  }
+}
+
+SinglePrecisionParMatrix::SinglePrecisionParMatrix(const mfem::HypreParMatrix& matrix)
+    : mfem::Operator(matrix.Height(), matrix.Width()), comm_(matrix.GetComm())
+{
+  Update(matrix);
+}
+
+void SinglePrecisionParMatrix::Update(const mfem::HypreParMatrix& matrix)
+{
+  height = matrix.Height();
+  width  = matrix.Width();
+  comm_  = matrix.GetComm();
+
+  mfem::SparseMatrix diag, offd;
+  HYPRE_BigInt*      offd_col_map;
+  matrix.GetDiag(diag);
+  matrix.GetOffd(offd, offd_col_map);
+  diag_.Assign(diag);
+  offd_.Assign(offd);
+
+  // The halo exchange follows hypre's own communication pattern for products with this matrix
+  hypre_ParCSRMatrix* parcsr = matrix;
+  if (!hypre_ParCSRMatrixCommPkg(parcsr)) {
+    hypre_MatvecCommPkgCreate(parcsr);
+  }
+  hypre_ParCSRCommPkg* comm_pkg = hypre_ParCSRMatrixCommPkg(parcsr);
+
+  const int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+  const int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+  send_procs_.assign(hypre_ParCSRCommPkgSendProcs(comm_pkg), hypre_ParCSRCommPkgSendProcs(comm_pkg) + num_sends);
+  send_starts_.assign(hypre_ParCSRCommPkgSendMapStarts(comm_pkg),
+                      hypre_ParCSRCommPkgSendMapStarts(comm_pkg) + num_sends + 1);
+  send_indices_.assign(hypre_ParCSRCommPkgSendMapElmts(comm_pkg),
+                       hypre_ParCSRCommPkgSendMapElmts(comm_pkg) + send_starts_.back());
+  recv_procs_.assign(hypre_ParCSRCommPkgRecvProcs(comm_pkg), hypre_ParCSRCommPkgRecvProcs(comm_pkg) + num_recvs);
+  recv_starts_.assign(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg),
+                      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) + num_recvs + 1);
+
+  send_buffer_.resize(send_indices_.size());
+  recv_buffer_.resize(static_cast<std::size_t>(recv_starts_.back()));
+  x_offd_.resize(recv_buffer_.size());
+  requests_.resize(static_cast<std::size_t>(num_sends + num_recvs));
+}
+
+void SinglePrecisionParMatrix::Mult(const mfem::Vector& x, mfem::Vector& y) const
+{
+  constexpr int halo_tag = 0;
+
+  const double* x_data = x.HostRead();
+  double*       y_data = y.HostWrite();
+
+  // Start the exchange of the off-processor entries of x, and overlap it with the local product
+  std::size_t request = 0;
+  for (std::size_t p = 0; p < recv_procs_.size(); p++) {
+    MPI_Irecv(recv_buffer_.data() + recv_starts_[p], recv_starts_[p + 1] - recv_starts_[p], MPI_FLOAT,
+              recv_procs_[p], halo_tag, comm_, &requests_[request++]);
+  }
+  for (std::size_t k = 0; k < send_indices_.size(); k++) {
+    send_buffer_[k] = static_cast<float>(x_data[send_indices_[k]]);
+  }
+  for (std::size_t p = 0; p < send_procs_.size(); p++) {
+    MPI_Isend(send_buffer_.data() + send_starts_[p], send_starts_[p + 1] - send_starts_[p], MPI_FLOAT,
+              send_procs_[p], halo_tag, comm_, &requests_[request++]);
+  }
+
+  std::fill(y_data, y_data + height, 0.0);
+  diag_.AddMult(x_data, y_data);
+
+  if (!requests_.empty()) {
+    MPI_Waitall(static_cast<int>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE);
+    std::copy(recv_buffer_.begin(), recv_buffer_.end(), x_offd_.begin());
+    offd_.AddMult(x_offd_.data(), y_data);
+  }
+}
+
+MixedPrecisionRefinementSolver::MixedPrecisionRefinementSolver(MPI_Comm                               comm,
+                                                               std::unique_ptr<mfem::IterativeSolver> solver,
+                                                               double inner_rel_tol)
+    : mfem::IterativeSolver(comm), solver_(std::move(solver)), inner_rel_tol_(inner_rel_tol)
+{
+  SLIC_ERROR_ROOT_IF(inner_rel_tol_ <= 0.0 || inner_rel_tol_ >= 1.0,
+                     "The relative tolerance of the correction solves must be between 0 and 1");
+  solver_->iterative_mode = false;
+}
+
+void MixedPrecisionRefinementSolver::SetOperator(const mfem::Operator& op)
+{
+  oper   = &op;
+  height = op.Height();
+  width  = op.Width();
+  if (prec) {
+    prec->SetOperator(op);
+  }
+
+  if (auto matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op)) {
+    if (single_) {
+      single_->Update(*matrix);
+    } else {
+      single_ = std::make_unique<SinglePrecisionParMatrix>(*matrix);
+    }
+    solver_->SetOperator(*single_);
+  } else {
+    single_.reset();
+    solver_->SetOperator(op);
+  }
+}
+
+void MixedPrecisionRefinementSolver::SetPreconditioner(mfem::Solver& pr)
+{
+  mfem::IterativeSolver::SetPreconditioner(pr);
+  prec_proxy_.prec = &pr;
+  solver_->SetPreconditioner(prec_proxy_);
+}
+
+void MixedPrecisionRefinementSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(!oper, "The operator must be set before solving");
+
+  // refinement has reached the accuracy of the single precision operator when it stops contracting
+  constexpr double stagnation_factor = 0.5;
+
+  r_.SetSize(height);
+  d_.SetSize(width);
+
+  if (!iterative_mode) {
+    x = 0.0;
+  }
+
+  oper->Mult(x, r_);
+  subtract(b, r_, r_);
+  double       norm = Norm(r_);
+  const double goal = std::max(rel_tol * norm, abs_tol);
+
+  solver_->SetAbsTol(0.0);
+  solver_->SetPrintLevel(print_level);
+
+  converged        = 0;
+  num_refinements_ = 0;
+  int iterations   = 0;
+  while (true) {
+    if (print_level == 1) {
+      mfem::out << "   Refinement : " << std::setw(3) << num_refinements_ << "  ||r|| = " << norm << '\n';
+    }
+    if (norm <= goal) {
+      converged = 1;
+      break;
+    }
+    if (!std::isfinite(norm) || iterations >= max_iter) {
+      break;
+    }
+
+    // the correction only needs to be as accurate as the remaining reduction of the residual
+    solver_->SetRelTol(std::max(inner_rel_tol_, goal / norm));
+    solver_->SetMaxIter(max_iter - iterations);
+    solver_->Mult(r_, d_);
+    iterations += solver_->GetNumIterations();
+    x += d_;
+    num_refinements_++;
+
+    oper->Mult(x, r_);
+    subtract(b, r_, r_);
+    const double previous_norm = norm;
+    norm                       = Norm(r_);
+    if (norm > goal && norm > stagnation_factor * previous_norm) {
+      SLIC_WARNING_ROOT_IF(print_level >= 0,
+                           "Mixed precision refinement stagnated, the operator may be too ill-conditioned for "
+                           "single precision correction solves");
+      break;
+    }
+  }
+
+  final_iter = iterations;
+  final_norm = norm;
+}
+
+}  // namespace serac::mfem_ext
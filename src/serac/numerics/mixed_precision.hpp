@@ -0,0 +1,189 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file mixed_precision.hpp
+ *
+ * @brief Linear solves whose inner Krylov iterations use a single precision copy of the operator, refined
+ * against the double precision residual
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "mfem.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief A copy of a HypreParMatrix whose entries are stored in single precision
+ *
+ * Products are accumulated in double precision, and the off-processor entries of the input vector are
+ * exchanged in single precision, so both the memory traffic of a product and its communication volume
+ * are roughly halved compared to the original matrix.
+ */
+class SinglePrecisionParMatrix : public mfem::Operator {
+public:
+  /**
+   * @brief Constructs the copy
+   * @param[in] matrix The double precision matrix
+   */
+  explicit SinglePrecisionParMatrix(const mfem::HypreParMatrix& matrix);
+
+  /**
+   * @brief Overwrites the copy with a new matrix, reusing the existing storage where possible
+   * @param[in] matrix The double precision matrix
+   */
+  void Update(const mfem::HypreParMatrix& matrix);
+
+  /**
+   * @brief Computes y = A x
+   * @param[in] x The input vector
+   * @param[out] y The product
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& x, mfem::Vector& y) const override;
+
+private:
+  /**
+   * @brief A processor-local CSR block with single precision entries
+   */
+  struct Block {
+    /// @brief Copies the pattern and (rounded) entries of a double precision block
+    void Assign(const mfem::SparseMatrix& block);
+
+    /// @brief y += A x
+    void AddMult(const double* x, double* y) const;
+
+    /// @brief The row offsets
+    std::vector<int> I;
+
+    /// @brief The column indices
+    std::vector<int> J;
+
+    /// @brief The entries
+    std::vector<float> values;
+  };
+
+  /// @brief The MPI communicator of the matrix
+  MPI_Comm comm_;
+
+  /// @brief The block coupling the local rows to the local columns
+  Block diag_;
+
+  /// @brief The block coupling the local rows to the off-processor columns
+  Block offd_;
+
+  /// @brief The ranks that local entries of the input vector are sent to, and the offsets of their entries
+  std::vector<int> send_procs_, send_starts_;
+
+  /// @brief The local indices of the entries that are sent
+  std::vector<int> send_indices_;
+
+  /// @brief The ranks that off-processor entries of the input vector are received from, and their offsets
+  std::vector<int> recv_procs_, recv_starts_;
+
+  /// @brief Communication buffers
+  mutable std::vector<float> send_buffer_, recv_buffer_;
+
+  /// @brief The off-processor entries of the input vector
+  mutable std::vector<double> x_offd_;
+
+  /// @brief The pending sends and receives
+  mutable std::vector<MPI_Request> requests_;
+};
+
+/**
+ * @brief Solves A x = b by iterative refinement: the residual is computed in double precision, and each
+ * correction is computed to a loose tolerance by a Krylov solver that applies a single precision copy of A
+ *
+ * Refinement contracts the error by roughly the inner tolerance in each step as long as the condition number
+ * of A is well below the inverse of the single precision unit roundoff (about 1e7), so it is intended for
+ * well-scaled problems. Refinement stops early when it stagnates. The preconditioner is built from the double
+ * precision operator, since the hypre preconditioners are not available in single precision, and operators
+ * other than a HypreParMatrix are applied in double precision by the inner solver as well.
+ */
+class MixedPrecisionRefinementSolver : public mfem::IterativeSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] solver The Krylov solver that computes the corrections
+   * @param[in] inner_rel_tol The relative tolerance of the correction solves
+   */
+  MixedPrecisionRefinementSolver(MPI_Comm comm, std::unique_ptr<mfem::IterativeSolver> solver, double inner_rel_tol);
+
+  /**
+   * @brief Sets the operator of the next solves and its single precision copy, and passes the operator
+   * to the preconditioner
+   * @param[in] op The linear operator
+   * @note Implements mfem::Operator::SetOperator
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Sets the preconditioner applied by the Krylov solver
+   * @param[in] pr The preconditioner
+   */
+  void SetPreconditioner(mfem::Solver& pr) override;
+
+  /**
+   * @brief Solves A x = b
+   * @param[in] b The right hand side
+   * @param[inout] x The solution, which is also the initial guess in iterative mode
+   * @note Implements mfem::Operator::Mult, and the reported number of iterations is the total over all
+   * correction solves
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The number of refinement steps of the last solve
+   */
+  int NumRefinements() const { return num_refinements_; }
+
+private:
+  /**
+   * @brief Forwards the Krylov solver's preconditioner applications, but not its operator updates, since the
+   * preconditioner is built from the double precision operator
+   */
+  class PreconditionerProxy : public mfem::Solver {
+  public:
+    /// @brief Ignores the single precision operator
+    void SetOperator(const mfem::Operator&) override {}
+
+    /**
+     * @brief Applies the preconditioner
+     * @param[in] r The input vector
+     * @param[out] z The preconditioned vector
+     */
+    void Mult(const mfem::Vector& r, mfem::Vector& z) const override { prec->Mult(r, z); }
+
+    /// @brief The preconditioner
+    mfem::Solver* prec = nullptr;
+  };
+
+  /// @brief The Krylov solver that computes the corrections
+  std::unique_ptr<mfem::IterativeSolver> solver_;
+
+  /// @brief The relative tolerance of the correction solves
+  double inner_rel_tol_;
+
+  /// @brief The single precision copy of the operator, if it is a HypreParMatrix
+  std::unique_ptr<SinglePrecisionParMatrix> single_;
+
+  /// @brief The preconditioner passed to the Krylov solver
+  PreconditionerProxy prec_proxy_;
+
+  /// @brief The number of refinement steps of the last solve
+  mutable int num_refinements_ = 0;
+
+  /// @brief The residual and the correction
+  mutable mfem::Vector r_, d_;
+};
+
+}  // namespace serac::mfem_ext
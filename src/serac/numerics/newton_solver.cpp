@@ -0,0 +1,431 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/newton_solver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac::mfem_ext {
+
+NewtonSolver::NewtonSolver(MPI_Comm comm, const NonlinearSolverOptions& options)
+    : mfem::NewtonSolver(comm),
+      max_jacobian_age_(options.max_jacobian_age.value_or(1)),
+      jacobian_refresh_rate_(options.jacobian_refresh_rate),
+      reuse_jacobian_across_solves_(options.reuse_jacobian_across_solves),
+      line_search_(options.line_search),
+      max_line_search_iterations_(options.max_line_search_iterations),
+      armijo_constant_(options.armijo_constant),
+      backtracking_factor_(options.backtracking_factor)
+{
+  SLIC_ERROR_ROOT_IF(max_jacobian_age_ < 0, "The maximum Jacobian age must be non-negative");
+  SLIC_ERROR_ROOT_IF(line_search_ != NewtonLineSearch::None && max_line_search_iterations_ < 1,
+                     "A line search requires at least one iteration");
+}
+
+void NewtonSolver::SetOperator(const mfem::Operator& op)
+{
+  mfem::NewtonSolver::SetOperator(op);
+  jacobian_valid_     = false;
+  jacobian_available_ = false;
+}
+
+void NewtonSolver::UpdateJacobian(const mfem::Vector& x) const
+{
+  grad = &oper->GetGradient(x);
+  prec->SetOperator(*grad);
+  jacobian_valid_     = true;
+  jacobian_available_ = true;
+  jacobian_age_       = 0;
+  num_jacobian_evaluations_++;
+}
+
+bool NewtonSolver::LaggedStep(const mfem::Vector& b, mfem::Vector& x) const
+{
+  if (!jacobian_available_) {
+    return false;
+  }
+
+  EvaluateResidual(x, b);
+  prec->iterative_mode = false;
+  prec->Mult(r, c);
+  x -= c;
+  return true;
+}
+
+bool NewtonSolver::JacobianNeedsUpdate() const
+{
+  return !jacobian_valid_ || (max_jacobian_age_ > 0 && jacobian_age_ >= max_jacobian_age_);
+}
+
+void NewtonSolver::ComputeStep(const mfem::Vector& x, int it, double norm) const
+{
+  if (JacobianNeedsUpdate()) {
+    UpdateJacobian(x);
+  }
+
+  if (lin_rtol_type) {
+    AdaptiveLinRtolPreSolve(x, it, norm);
+  }
+
+  prec->Mult(r, c);  // c = [DF(x_j)]^{-1} [F(x_i)-b], where j <= i is the iteration the Jacobian was last evaluated at
+
+  if (lin_rtol_type) {
+    AdaptiveLinRtolPostSolve(c, r, it, norm);
+  }
+}
+
+double NewtonSolver::EvaluateResidual(const mfem::Vector& x, const mfem::Vector& b) const
+{
+  ProcessNewState(x);
+
+  oper->Mult(x, r);
+  if (b.Size() == Height()) {
+    r -= b;
+  }
+  return Norm(r);
+}
+
+double NewtonSolver::LineSearch(const mfem::Vector& b, mfem::Vector& x, double norm) const
+{
+  x0_ = x;
+
+  if (line_search_ == NewtonLineSearch::Backtracking) {
+    // Armijo condition for the residual norm, the merit function of an inexact Newton step
+    double alpha    = 1.0;
+    double new_norm = norm;
+    for (int k = 0; k < max_line_search_iterations_; k++) {
+      add(x0_, -alpha, c, x);
+      new_norm = EvaluateResidual(x, b);
+      if (mfem::IsFinite(new_norm) && new_norm <= (1.0 - armijo_constant_ * alpha) * norm) {
+        return new_norm;
+      }
+      alpha *= backtracking_factor_;
+    }
+    SLIC_WARNING_ROOT_IF(print_level >= 0, "Newton line search failed to find a sufficient decrease");
+    return new_norm;
+  }
+
+  // Critical point line search: when the residual is the gradient of an energy E, find a stationary point
+  // of E(x - alpha c) with secant iterations on g(alpha) = (F(x - alpha c) - b) . c, which is proportional to
+  // the derivative of E along the search direction. The iterates are kept inside a bracket [lo, hi] that holds
+  // the sign change of g, secant steps that leave it fall back to backtracking towards lo, and the trial with
+  // the smallest residual norm is returned
+  constexpr double critical_point_tolerance = 1.0e-2;
+
+  const double g0         = Dot(r, c);
+  double       lo         = 0.0;
+  double       hi         = std::numeric_limits<double>::infinity();
+  double       alpha_prev = 0.0;
+  double       g_prev     = g0;
+  double       alpha      = 1.0;
+  double       trial      = alpha;
+  double       trial_norm = norm;
+  double       best_alpha = alpha;
+  double       best_norm  = std::numeric_limits<double>::infinity();
+  for (int k = 0; k < max_line_search_iterations_; k++) {
+    trial = alpha;
+    add(x0_, -trial, c, x);
+    trial_norm     = EvaluateResidual(x, b);
+    const double g = Dot(r, c);
+    if (mfem::IsFinite(trial_norm) && trial_norm < best_norm) {
+      best_alpha = trial;
+      best_norm  = trial_norm;
+    }
+
+    // a step that leaves the domain of the energy bounds the search from above
+    if (!mfem::IsFinite(trial_norm) || !mfem::IsFinite(g)) {
+      hi    = trial;
+      alpha = lo + backtracking_factor_ * (hi - lo);
+      continue;
+    }
+
+    if (std::abs(g) <= critical_point_tolerance * std::abs(g0)) {
+      break;
+    }
+
+    if ((g > 0.0) == (g0 > 0.0)) {
+      lo = trial;
+    } else {
+      hi = trial;
+    }
+
+    const double alpha_next = (g == g_prev) ? -1.0 : trial - g * (trial - alpha_prev) / (g - g_prev);
+    alpha_prev              = trial;
+    g_prev                  = g;
+    if (mfem::IsFinite(alpha_next) && lo < alpha_next && alpha_next < hi) {
+      alpha = alpha_next;
+    } else if (hi < std::numeric_limits<double>::infinity()) {
+      alpha = lo + backtracking_factor_ * (hi - lo);
+    } else {
+      // without a bracket there is nothing to fall back to
+      break;
+    }
+  }
+
+  if (!mfem::IsFinite(best_norm)) {
+    SLIC_WARNING_ROOT_IF(print_level >= 0, "Newton line search found no step with a finite residual");
+    return trial_norm;
+  }
+
+  SLIC_WARNING_ROOT_IF(print_level >= 0 && best_norm >= norm, "Newton line search failed to reduce the residual");
+  if (best_alpha != trial) {
+    add(x0_, -best_alpha, c, x);
+    best_norm = EvaluateResidual(x, b);
+  }
+  return best_norm;
+}
+
+void NewtonSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(oper == nullptr, "The nonlinear operator is not set (use SetOperator)");
+  SLIC_ERROR_ROOT_IF(prec == nullptr, "The linear solver is not set (use SetSolver)");
+
+  if (!iterative_mode) {
+    x = 0.0;
+  }
+
+  double       norm         = EvaluateResidual(x, b);
+  const double initial_norm = norm;
+  const double norm_goal    = std::max(rel_tol * norm, abs_tol);
+
+  prec->iterative_mode = false;
+
+  // x_{i+1} = x_i - alpha_i c_i, see ComputeStep
+  int it;
+  for (it = 0; true; it++) {
+    if (print_level >= 0) {
+      mfem::out << "Newton iteration " << std::setw(2) << it << " : ||r|| = " << norm;
+      if (it > 0) {
+        mfem::out << ", ||r||/||r_0|| = " << norm / initial_norm;
+      }
+      mfem::out << '\n';
+    }
+    Monitor(it, norm, r, x);
+
+    if (norm <= norm_goal) {
+      converged = 1;
+      break;
+    }
+
+    if (!mfem::IsFinite(norm)) {
+      SLIC_WARNING_ROOT("Newton residual norm is not finite");
+      converged = 0;
+      break;
+    }
+
+    if (it >= max_iter) {
+      converged = 0;
+      break;
+    }
+
+    ComputeStep(x, it, norm);
+
+    double new_norm;
+    if (line_search_ == NewtonLineSearch::None) {
+      const double c_scale = ComputeScalingFactor(x, b);
+      if (c_scale == 0.0) {
+        converged = 0;
+        break;
+      }
+      add(x, -c_scale, c, x);
+      new_norm = EvaluateResidual(x, b);
+    } else {
+      new_norm = LineSearch(b, x, norm);
+    }
+    jacobian_age_++;
+
+    // an outdated Jacobian that no longer contracts the residual fast enough is refreshed
+    if (new_norm > jacobian_refresh_rate_ * norm) {
+      jacobian_valid_ = false;
+    }
+    norm = new_norm;
+  }
+
+  if (!reuse_jacobian_across_solves_) {
+    jacobian_valid_ = false;
+  }
+
+  // the adaptive forcing terms leave the last one in the linear solver, see SetLinearRelTol
+  if (lin_rtol_type && linear_rel_tol_) {
+    static_cast<mfem::IterativeSolver*>(prec)->SetRelTol(*linear_rel_tol_);
+  }
+
+  final_iter = it;
+  final_norm = norm;
+}
+
+QuasiNewtonSolver::QuasiNewtonSolver(MPI_Comm comm, const NonlinearSolverOptions& options)
+    : NewtonSolver(comm, options), method_(options.nonlin_solver), memory_(options.quasi_newton_memory)
+{
+  SLIC_ERROR_ROOT_IF(method_ != NonlinearSolver::LBFGS && method_ != NonlinearSolver::Broyden &&
+                         method_ != NonlinearSolver::Anderson,
+                     "QuasiNewtonSolver requires the LBFGS, Broyden or Anderson nonlinear solver type");
+  SLIC_ERROR_ROOT_IF(memory_ < 1, "The quasi-Newton memory must be positive");
+
+  // unless a maximum age is requested, H_0 is only refreshed when the iteration stagnates
+  max_jacobian_age_ = options.max_jacobian_age.value_or(0);
+}
+
+void QuasiNewtonSolver::ClearHistory() const
+{
+  s_.clear();
+  y_.clear();
+  u_.clear();
+  have_prev_ = false;
+}
+
+void QuasiNewtonSolver::ComputeStep(const mfem::Vector& x, int it, double) const
+{
+  // the history belongs to a single solve and a single H_0
+  if (it == 0) {
+    ClearHistory();
+  }
+  if (JacobianNeedsUpdate()) {
+    UpdateJacobian(x);
+    ClearHistory();
+  }
+
+  // stores a new iterate difference, discarding the oldest one if the memory is full
+  auto push = [this](std::deque<mfem::Vector>& history, mfem::Vector&& difference) {
+    history.emplace_back(std::move(difference));
+    if (static_cast<int>(history.size()) > memory_) {
+      history.pop_front();
+    }
+  };
+
+  switch (method_) {
+    case NonlinearSolver::LBFGS:
+      if (have_prev_) {
+        mfem::Vector s(x), y(r);
+        s -= x_prev_;
+        y -= r_prev_;
+        // pairs without positive curvature would make the approximation indefinite
+        if (Dot(s, y) > std::numeric_limits<double>::epsilon() * std::sqrt(Dot(s, s) * Dot(y, y))) {
+          push(s_, std::move(s));
+          push(y_, std::move(y));
+        }
+      }
+      LBFGSStep();
+      break;
+    case NonlinearSolver::Broyden:
+      BroydenStep(x);
+      break;
+    case NonlinearSolver::Anderson:
+      prec->Mult(r, g_);
+      if (have_prev_) {
+        mfem::Vector s(x), y(g_);
+        s -= x_prev_;
+        y -= g_prev_;
+        push(s_, std::move(s));
+        push(y_, std::move(y));
+      }
+      AndersonStep();
+      g_prev_ = g_;
+      break;
+    default:
+      break;
+  }
+
+  x_prev_    = x;
+  r_prev_    = r;
+  have_prev_ = true;
+
+  // Broyden's method restarts from H_0 once its memory is full, as its updates depend on all previous ones
+  if (method_ == NonlinearSolver::Broyden && static_cast<int>(u_.size()) >= memory_) {
+    ClearHistory();
+  }
+}
+
+void QuasiNewtonSolver::LBFGSStep() const
+{
+  // two-loop recursion, with H_0 applied by the linear solver
+  const auto          m = s_.size();
+  std::vector<double> rho(m), a(m);
+
+  q_ = r;
+  for (auto i = m; i-- > 0;) {
+    rho[i] = 1.0 / Dot(y_[i], s_[i]);
+    a[i]   = rho[i] * Dot(s_[i], q_);
+    q_.Add(-a[i], y_[i]);
+  }
+
+  prec->Mult(q_, c);
+
+  for (std::size_t i = 0; i < m; i++) {
+    const double b = rho[i] * Dot(y_[i], c);
+    c.Add(a[i] - b, s_[i]);
+  }
+}
+
+void QuasiNewtonSolver::BroydenStep(const mfem::Vector& x) const
+{
+  // H_j = H_0 + sum_{i < j} u_i y_i^T / (y_i . y_i), where u_i = s_i - H_i y_i, so q = H_j r
+  prec->Mult(r, q_);
+  for (std::size_t i = 0; i < u_.size(); i++) {
+    q_.Add(Dot(y_[i], r) / Dot(y_[i], y_[i]), u_[i]);
+  }
+
+  if (have_prev_) {
+    mfem::Vector y(r);
+    y -= r_prev_;
+    const double yy = Dot(y, y);
+    if (yy > 0.0) {
+      // u = s - H_j y, where H_j y = H_j r - H_j r_prev = q - c, as c still holds the previous step
+      mfem::Vector u(x);
+      u -= x_prev_;
+      u -= q_;
+      u += c;
+      q_.Add(Dot(y, r) / yy, u);
+      u_.emplace_back(std::move(u));
+      y_.emplace_back(std::move(y));
+    }
+  }
+  c = q_;
+}
+
+void QuasiNewtonSolver::AndersonStep() const
+{
+  // minimize || g - sum_i gamma_i y_i || over gamma, then
+  // c = g + sum_i gamma_i (s_i - y_i), the step to the mixed iterate
+  const auto m = static_cast<int>(s_.size());
+  c            = g_;
+  if (m == 0) {
+    return;
+  }
+
+  mfem::DenseMatrix A(m);
+  mfem::Vector      rhs(m), gamma(m);
+  double            trace = 0.0;
+  for (int i = 0; i < m; i++) {
+    auto ui = static_cast<std::size_t>(i);
+    rhs[i]  = Dot(y_[ui], g_);
+    for (int j = 0; j <= i; j++) {
+      A(i, j) = A(j, i) = Dot(y_[ui], y_[static_cast<std::size_t>(j)]);
+    }
+    trace += A(i, i);
+  }
+
+  // a small regularization guards against (nearly) linearly dependent differences
+  for (int i = 0; i < m; i++) {
+    A(i, i) += 1.0e-12 * trace;
+  }
+  mfem::DenseMatrixInverse(A).Mult(rhs, gamma);
+
+  for (int i = 0; i < m; i++) {
+    auto ui = static_cast<std::size_t>(i);
+    c.Add(gamma[i], s_[ui]);
+    c.Add(-gamma[i], y_[ui]);
+  }
+}
+
+}  // namespace serac::mfem_ext
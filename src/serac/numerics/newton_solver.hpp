@@ -0,0 +1,235 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file newton_solver.hpp
+ *
+ * @brief Newton-Raphson and quasi-Newton solvers that can reuse their Jacobian across iterations and solves
+ */
+
+#pragma once
+
+#include <deque>
+#include <optional>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief A Newton-Raphson solver that extends mfem::NewtonSolver with Jacobian reuse ("modified Newton")
+ * and line search globalization
+ *
+ * The Jacobian, and therefore the linear solver's preconditioner or factorization, is only re-evaluated
+ * when it has been used for NonlinearSolverOptions::max_jacobian_age iterations, or when the residual norm
+ * contracts by less than NonlinearSolverOptions::jacobian_refresh_rate in a single iteration.
+ * With the default options, the Jacobian is evaluated every iteration, as in mfem::NewtonSolver.
+ */
+class NewtonSolver : public mfem::NewtonSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] options The nonlinear solver parameters controlling Jacobian reuse
+   */
+  NewtonSolver(MPI_Comm comm, const NonlinearSolverOptions& options);
+
+  /**
+   * @brief Sets the nonlinear operator, discarding any stored Jacobian
+   * @param[in] op The nonlinear operator
+   * @note Implements mfem::Operator::SetOperator
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Solves the nonlinear system F(x) = b
+   * @param[in] b The right hand side, or an empty vector for b = 0
+   * @param[inout] x The solution, which is also the initial guess in iterative mode
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief Discards the stored Jacobian, so the next iteration evaluates a new one
+   */
+  void InvalidateJacobian() { jacobian_valid_ = false; }
+
+  /**
+   * @brief Takes the single step x = x - J^{-1} (F(x) - b) with the most recently evaluated Jacobian J, reusing
+   * the linear solver's current preconditioner or factorization, e.g. to predict the solution of the next load step
+   * @param[in] b The right hand side, or an empty vector for b = 0
+   * @param[inout] x The initial guess, overwritten with the updated guess
+   * @return Whether a Jacobian was available, otherwise x is unchanged
+   */
+  bool LaggedStep(const mfem::Vector& b, mfem::Vector& x) const;
+
+  /**
+   * @brief Sets the relative tolerance of the linear solver that is restored at the end of each solve
+   *
+   * The adaptive forcing terms (see mfem::NewtonSolver::SetAdaptiveLinRtol) overwrite the relative tolerance of
+   * the linear solver in every iteration. Other solves that share the linear solver, e.g. adjoint solves, should
+   * use the configured tolerance instead of the last forcing term.
+   *
+   * @param[in] rel_tol The configured relative tolerance of the linear solver
+   */
+  void SetLinearRelTol(double rel_tol) { linear_rel_tol_ = rel_tol; }
+
+  /**
+   * @brief The total number of Jacobian evaluations performed by this solver
+   */
+  int NumJacobianEvaluations() const { return num_jacobian_evaluations_; }
+
+protected:
+  /**
+   * @brief Evaluates the Jacobian at x and passes it to the linear solver
+   * @param[in] x The current iterate
+   */
+  void UpdateJacobian(const mfem::Vector& x) const;
+
+  /**
+   * @brief Whether the Jacobian must be re-evaluated before the next step
+   */
+  bool JacobianNeedsUpdate() const;
+
+  /**
+   * @brief Computes the step c (stored in mfem::NewtonSolver::c), such that x_{i+1} = x_i - alpha c
+   * @param[in] x The current iterate, whose residual is stored in mfem::NewtonSolver::r
+   * @param[in] it The iteration number
+   * @param[in] norm The residual norm at the current iterate
+   */
+  virtual void ComputeStep(const mfem::Vector& x, int it, double norm) const;
+
+  /**
+   * @brief Evaluates the residual r = F(x) - b
+   * @param[in] x The current iterate
+   * @param[in] b The right hand side, or an empty vector for b = 0
+   * @return The norm of the residual
+   */
+  double EvaluateResidual(const mfem::Vector& x, const mfem::Vector& b) const;
+
+  /**
+   * @brief Updates x along the Newton direction, x = x - alpha c, choosing alpha with the configured line search
+   * @param[in] b The right hand side, or an empty vector for b = 0
+   * @param[inout] x The current iterate, overwritten with the updated iterate
+   * @param[in] norm The residual norm at the current iterate
+   * @return The residual norm at the updated iterate, whose residual is left in mfem::NewtonSolver::r
+   */
+  double LineSearch(const mfem::Vector& b, mfem::Vector& x, double norm) const;
+
+  /// @brief The maximum number of iterations a Jacobian is reused for, 0 for no limit
+  int max_jacobian_age_;
+
+  /// @brief The residual contraction factor above which the Jacobian is refreshed
+  double jacobian_refresh_rate_;
+
+  /// @brief Whether the Jacobian may be reused by subsequent calls to Mult
+  bool reuse_jacobian_across_solves_;
+
+  /// @brief The line search used to globalize the Newton iteration
+  NewtonLineSearch line_search_;
+
+  /// @brief The maximum number of residual evaluations per line search
+  int max_line_search_iterations_;
+
+  /// @brief The sufficient decrease constant of the backtracking line search
+  double armijo_constant_;
+
+  /// @brief The step length reduction factor of the backtracking line search
+  double backtracking_factor_;
+
+  /// @brief The relative tolerance of the linear solver outside of the adaptive forcing term iterations
+  std::optional<double> linear_rel_tol_;
+
+  /// @brief The iterate at the start of a line search
+  mutable mfem::Vector x0_;
+
+  /// @brief Whether the Jacobian stored in mfem::NewtonSolver::grad is usable
+  mutable bool jacobian_valid_ = false;
+
+  /// @brief Whether the linear solver holds a Jacobian of the current operator, even if it is too old to be reused
+  mutable bool jacobian_available_ = false;
+
+  /// @brief The number of iterations the current Jacobian has been used for
+  mutable int jacobian_age_ = 0;
+
+  /// @brief The total number of Jacobian evaluations
+  mutable int num_jacobian_evaluations_ = 0;
+};
+
+/**
+ * @brief Nonlinear solvers that only apply the inverse of an (outdated) Jacobian, H_0, through the
+ * linear solver, and improve on it with the residuals of previous iterations
+ *
+ * The methods supported are
+ *  - NonlinearSolver::LBFGS, the limited-memory BFGS update of H_0, for symmetric Jacobians
+ *  - NonlinearSolver::Broyden, Broyden's (second) method, restarted when its memory is full
+ *  - NonlinearSolver::Anderson, Anderson acceleration of the fixed point iteration x_{i+1} = x_i - H_0 r(x_i)
+ *
+ * H_0 is refreshed according to the same criteria as NewtonSolver, which also discards the history, except that
+ * by default it is only refreshed when the convergence rate degrades (NonlinearSolverOptions::max_jacobian_age = 0).
+ */
+class QuasiNewtonSolver : public NewtonSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] options The nonlinear solver parameters, including the method and its memory
+   */
+  QuasiNewtonSolver(MPI_Comm comm, const NonlinearSolverOptions& options);
+
+protected:
+  /**
+   * @brief Computes the step from the history of previous iterates and one application of H_0
+   * @param[in] x The current iterate, whose residual is stored in mfem::NewtonSolver::r
+   * @param[in] it The iteration number
+   * @param[in] norm The residual norm at the current iterate
+   */
+  void ComputeStep(const mfem::Vector& x, int it, double norm) const override;
+
+private:
+  /// @brief Discards all stored iterates
+  void ClearHistory() const;
+
+  /// @brief c = H r for the L-BFGS approximation H of the inverse Jacobian
+  void LBFGSStep() const;
+
+  /**
+   * @brief c = H r for the Broyden approximation H of the inverse Jacobian
+   * @param[in] x The current iterate
+   */
+  void BroydenStep(const mfem::Vector& x) const;
+
+  /// @brief The Anderson-accelerated fixed point step
+  void AndersonStep() const;
+
+  /// @brief The quasi-Newton method
+  NonlinearSolver method_;
+
+  /// @brief The maximum number of stored iterate differences
+  int memory_;
+
+  /// @brief The iterate, residual, and step (or preconditioned residual) of the previous iteration
+  mutable mfem::Vector x_prev_, r_prev_, g_prev_;
+
+  /// @brief Whether x_prev_, r_prev_ and g_prev_ hold a previous iteration of the current solve
+  mutable bool have_prev_ = false;
+
+  /// @brief Differences of the iterates between iterations
+  mutable std::deque<mfem::Vector> s_;
+
+  /// @brief Differences of the residuals (or preconditioned residuals for Anderson) between iterations
+  mutable std::deque<mfem::Vector> y_;
+
+  /// @brief The Broyden update directions, s - H y
+  mutable std::deque<mfem::Vector> u_;
+
+  /// @brief Scratch vectors
+  mutable mfem::Vector q_, g_;
+};
+
+}  // namespace serac::mfem_ext
@@ -6,10 +6,67 @@
 
 #include "serac/numerics/odes.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "serac/numerics/expr_template_ops.hpp"
 
 namespace serac::mfem_ext {
 
+namespace {
+
+/// @brief The high frequency dissipation of the first order generalized-alpha method
+constexpr double generalized_alpha_rho_inf = 0.5;
+
+/**
+ * @brief Evaluates the essential boundary conditions and their time derivatives at the constrained true DOFs
+ *
+ * Analytic time derivatives are used where a boundary condition supplies them, and centered finite differences
+ * over a 3-point stencil of times otherwise. Only the entries of the constrained DOFs are written.
+ *
+ * @param[in] bcs The boundary conditions
+ * @param[in] time The time of interest
+ * @param[in] epsilon The time step of the finite differences
+ * @param[out] U The values of the constraints
+ * @param[out] dU_dt The first time derivatives of the constraints, or nullptr if they are not needed
+ * @param[out] d2U_dt2 The second time derivatives of the constraints, or nullptr if they are not needed
+ * @param U_minus Working vector for the constraints at time - epsilon
+ * @param U_plus Working vector for the constraints at time + epsilon
+ */
+void evaluateConstraints(const BoundaryConditionManager& bcs, const double time, const double epsilon,
+                         mfem::Vector& U, mfem::Vector* dU_dt, mfem::Vector* d2U_dt2, mfem::Vector& U_minus,
+                         mfem::Vector& U_plus)
+{
+  for (const auto& bc : bcs.essentials()) {
+    bc.projectBdrToDofs(U, time);
+
+    const bool differentiate_rate   = dU_dt && !bc.hasTimeDerivative(1);
+    const bool differentiate_second = d2U_dt2 && !bc.hasTimeDerivative(2);
+    if (dU_dt && !differentiate_rate) {
+      bc.projectBdrTimeDerivativeToDofs(*dU_dt, time, 1);
+    }
+    if (d2U_dt2 && !differentiate_second) {
+      bc.projectBdrTimeDerivativeToDofs(*d2U_dt2, time, 2);
+    }
+    if (!differentiate_rate && !differentiate_second) {
+      continue;
+    }
+
+    bc.projectBdrToDofs(U_minus, time - epsilon);
+    bc.projectBdrToDofs(U_plus, time + epsilon);
+    for (int i : bc.getTrueDofs()) {
+      if (differentiate_rate) {
+        (*dU_dt)[i] = (U_plus[i] - U_minus[i]) / (2.0 * epsilon);
+      }
+      if (differentiate_second) {
+        (*d2U_dt2)[i] = (U_minus[i] - 2.0 * U[i] + U_plus[i]) / (epsilon * epsilon);
+      }
+    }
+  }
+}
+
+}  // namespace
+
 SecondOrderODE::SecondOrderODE(int n, State&& state, const EquationSolver& solver, const BoundaryConditionManager& bcs)
     : mfem::SecondOrderTimeDependentOperator(n, 0.0), state_(std::move(state)), solver_(solver), bcs_(bcs), zero_(n)
 {
@@ -23,6 +80,7 @@ SecondOrderODE::SecondOrderODE(int n, State&& state, const EquationSolver& solve
 
 void SecondOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
 {
+  timestepper_ = timestepper;
   switch (timestepper) {
     case serac::TimestepMethod::Newmark:
       second_order_ode_solver_ = std::make_unique<mfem::NewmarkSolver>();
@@ -57,6 +115,8 @@ void SecondOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
       break;
     case serac::TimestepMethod::BackwardEuler:
       first_order_system_ode_solver_ = std::make_unique<mfem::BackwardEulerSolver>();
+      first_order_system_.SetSize(2 * Height());
+      u_next_.SetSize(Height());
       break;
     default:
       SLIC_ERROR_ROOT("Timestep method was not a supported second-order ODE method");
@@ -74,44 +134,128 @@ void SecondOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
   }
 }
 
+void SecondOrderODE::SetAdaptivity(const AdaptiveTimestepOptions& options, MPI_Comm comm)
+{
+  SLIC_ERROR_ROOT_IF(!second_order_ode_solver_ && !first_order_system_ode_solver_,
+                     "SetTimestepper must be called before SetAdaptivity");
+  controller_ = std::make_unique<TimestepController>(options, comm);
+
+  switch (timestepper_) {
+    case serac::TimestepMethod::Newmark:
+    case serac::TimestepMethod::HHTAlpha:
+    case serac::TimestepMethod::WBZAlpha:
+    case serac::TimestepMethod::AverageAcceleration:
+      // SetTimestepper creates these methods with their default parameters, which coincide with the trapezoidal
+      // rule. The estimate has to be revisited if their parameters (e.g. rho_inf of HHTAlpha and WBZAlpha) are
+      // ever made configurable.
+      newmark_beta_ = 0.25;
+      controller_->SetOrder(3);
+      break;
+    case serac::TimestepMethod::FoxGoodwin:
+      newmark_beta_ = 1.0 / 12.0;
+      controller_->SetOrder(3);
+      break;
+    case serac::TimestepMethod::CentralDifference:
+      newmark_beta_ = 0.0;
+      controller_->SetOrder(3);
+      break;
+    case serac::TimestepMethod::BackwardEuler:
+      controller_->SetOrder(2);
+      break;
+    default:
+      SLIC_ERROR_ROOT("Adaptive time stepping is not supported by the selected second-order ODE method");
+  }
+
+  x_old_.SetSize(height);
+  v_old_.SetSize(height);
+  accel_old_.SetSize(height);
+  error_.SetSize(height);
+}
+
 void SecondOrderODE::Step(mfem::Vector& x, mfem::Vector& dxdt, double& time, double& dt)
+{
+  if (!controller_) {
+    FixedStep(x, dxdt, time, dt);
+    return;
+  }
+
+  // the Newmark-family estimates compare against the acceleration at the start of the step
+  if (second_order_ode_solver_ && !start_rate_valid_) {
+    Solve(time, 0.0, 0.0, x, dxdt, accel_old_);
+    start_rate_valid_ = true;
+  }
+  accel_old_ = state_.d2u_dt2;
+
+  const double            t0     = time;
+  const double            dt_max = dt;
+  const SolutionPredictor predictor(predictor_);
+  x_old_ = x;
+  v_old_ = dxdt;
+
+  while (true) {
+    const double h     = controller_->Proposal(dt_max);
+    double       t_end = t0;
+    nonlinear_failure_ = false;
+    FixedStep(x, dxdt, t_end, h);
+
+    bool accepted = false;
+    if (nonlinear_failure_) {
+      controller_->Cutback(h);
+    } else {
+      if (second_order_ode_solver_) {
+        add(state_.d2u_dt2, -1.0, accel_old_, error_);
+        error_ *= h * h * std::abs(newmark_beta_ - 1.0 / 6.0);
+      } else {
+        add(0.5 * h, dxdt, -0.5 * h, v_old_, error_);
+      }
+      accepted = controller_->Accept(controller_->ErrorNorm(error_, x_old_, x), h);
+    }
+
+    if (accepted) {
+      time = t_end;
+      dt   = h;
+      return;
+    }
+
+    // roll back to the start of the step, and discard the history the ODE solvers keep between steps
+    x              = x_old_;
+    dxdt           = v_old_;
+    state_.d2u_dt2 = accel_old_;
+    predictor_     = predictor;
+    if (second_order_ode_solver_) {
+      second_order_ode_solver_->Init(*this);
+    } else {
+      first_order_system_ode_solver_->Init(*this);
+    }
+  }
+}
+
+void SecondOrderODE::FixedStep(mfem::Vector& x, mfem::Vector& dxdt, double& time, double dt)
 {
   if (second_order_ode_solver_) {
     // if we used a 2nd order method
     second_order_ode_solver_->Step(x, dxdt, time, dt);
 
     if (enforcement_method_ == DirichletEnforcementMethod::FullControl) {
-      U_minus_ = 0.0;
-      U_       = 0.0;
-      U_plus_  = 0.0;
-      for (const auto& bc : bcs_.essentials()) {
-        bc.projectBdrToDofs(U_minus_, t - epsilon);
-        bc.projectBdrToDofs(U_, t);
-        bc.projectBdrToDofs(U_plus_, t + epsilon);
-      }
-
-      auto constrained_dofs = bcs_.allEssentialDofs();
-      for (int i = 0; i < constrained_dofs.Size(); i++) {
+      evaluateConstraints(bcs_, t, epsilon, U_, &dU_dt_, nullptr, U_minus_, U_plus_);
+      for (int i : bcs_.allEssentialDofs()) {
         x[i]    = U_[i];
-        dxdt[i] = (U_plus_[i] - U_minus_[i]) / (2.0 * epsilon);
+        dxdt[i] = dU_dt_[i];
       }
     }
 
   } else if (first_order_system_ode_solver_) {
-    // Would be better if displacement and velocity were from a block vector?
-    mfem::Array<int> boffsets(3);
-    boffsets[0] = 0;
-    boffsets[1] = x.Size();
-    boffsets[2] = x.Size() + dxdt.Size();
-    mfem::BlockVector bx(boffsets);
-    bx.GetBlock(0) = x;
-    bx.GetBlock(1) = dxdt;
+    // the displacement and velocity are stepped together in preallocated storage
+    mfem::Vector bx(first_order_system_, 0, x.Size());
+    mfem::Vector bdxdt(first_order_system_, x.Size(), dxdt.Size());
+    bx    = x;
+    bdxdt = dxdt;
 
-    first_order_system_ode_solver_->Step(bx, time, dt);
+    first_order_system_ode_solver_->Step(first_order_system_, time, dt);
 
     // Copy back
-    x    = bx.GetBlock(0);
-    dxdt = bx.GetBlock(1);
+    x    = bx;
+    dxdt = bdxdt;
   } else {
     SLIC_ERROR_ROOT("Neither second_order_ode_solver_ nor first_order_system_ode_solver_ specified");
   }
@@ -128,21 +272,20 @@ void SecondOrderODE::ImplicitSolve(const double dt, const mfem::Vector& u, mfem:
     u_next = (u_prev + dt * v_prev) + dt*dt*a_next
   */
 
-  // Split u in half and du_dt in half?
-  mfem::Array<int> boffsets(3);
-  boffsets[0] = 0;
-  boffsets[1] = u.Size() / 2;
-  boffsets[2] = u.Size();
+  // views of the displacement and velocity halves of u and du_dt, which do not allocate
+  const int          n = u.Size() / 2;
+  const mfem::Vector u_prev(u.GetData(), n);
+  const mfem::Vector v_prev(u.GetData() + n, n);
+  mfem::Vector       du(du_dt.GetData(), n);
+  mfem::Vector       dv(du_dt.GetData() + n, n);
 
-  const mfem::BlockVector bu(u.GetData(), boffsets);
-
-  mfem::BlockVector bdu_dt(du_dt.GetData(), boffsets);
+  add(u_prev, dt, v_prev, u_next_);
   Solve(t, dt * dt, dt,
-        bu.GetBlock(0) + bu.GetBlock(1) * dt,  // u_next
-        bu.GetBlock(1),                        // v_next
-        bdu_dt.GetBlock(1));                   // a_next
+        u_next_,  // u_next
+        v_prev,   // v_next
+        dv);      // a_next
 
-  bdu_dt.GetBlock(0) = bu.GetBlock(1) + dt * bdu_dt.GetBlock(1);
+  add(v_prev, dt, dv, du);
 }
 
 void SecondOrderODE::Solve(const double time, const double c0, const double c1, const mfem::Vector& u,
@@ -155,62 +298,59 @@ void SecondOrderODE::Solve(const double time, const double c0, const double c1,
   state_.u     = u;
   state_.du_dt = du_dt;
 
-  // evaluate the constraint functions at a 3-point
-  // stencil of times centered on the time of interest
-  // in order to compute finite-difference approximations
-  // to the time derivatives that appear in the residual
-  U_minus_ = 0.0;
-  U_       = 0.0;
-  U_plus_  = 0.0;
-  for (const auto& bc : bcs_.essentials()) {
-    bc.projectBdrToDofs(U_minus_, time - epsilon);
-    bc.projectBdrToDofs(U_, time);
-    bc.projectBdrToDofs(U_plus_, time + epsilon);
-  }
+  // evaluate the constraint functions and the time derivatives
+  // that appear in the residual at the constrained dofs only
+  const bool implicit = (c0 != 0.0 || c1 != 0.0);
+  const bool direct   = implicit && enforcement_method_ == DirichletEnforcementMethod::DirectControl;
+  const bool rate     = implicit && enforcement_method_ == DirichletEnforcementMethod::RateControl;
+  evaluateConstraints(bcs_, time, epsilon, U_, direct ? nullptr : &dU_dt_, (direct || rate) ? nullptr : &d2U_dt2_,
+                      U_minus_, U_plus_);
+
+  const auto& constrained_dofs = bcs_.allEssentialDofs();
+  for (int i : constrained_dofs) {
+    if (implicit) {
+      if (enforcement_method_ == DirichletEnforcementMethod::DirectControl) {
+        d2U_dt2_[i] = (U_[i] - u[i]) / c0;
+        dU_dt_[i]   = du_dt[i];
+        U_[i]       = u[i];
+      }
 
-  bool implicit = (c0 != 0.0 || c1 != 0.0);
-  if (implicit) {
-    if (enforcement_method_ == DirichletEnforcementMethod::DirectControl) {
-      d2U_dt2_ = (U_ - u) / c0;
-      dU_dt_   = du_dt;
-      U_       = u;
-    }
+      if (enforcement_method_ == DirichletEnforcementMethod::RateControl) {
+        d2U_dt2_[i] = (dU_dt_[i] - du_dt[i]) / c1;
+        dU_dt_[i]   = du_dt[i];
+        U_[i]       = u[i];
+      }
 
-    if (enforcement_method_ == DirichletEnforcementMethod::RateControl) {
-      d2U_dt2_ = ((U_plus_ - U_minus_) / (2.0 * epsilon) - du_dt) / c1;
-      dU_dt_   = du_dt;
-      U_       = u;
+      if (enforcement_method_ == DirichletEnforcementMethod::FullControl) {
+        dU_dt_[i] -= c1 * d2U_dt2_[i];
+        U_[i] -= c0 * d2U_dt2_[i];
+      }
     }
 
-    if (enforcement_method_ == DirichletEnforcementMethod::FullControl) {
-      d2U_dt2_ = (U_minus_ - 2.0 * U_ + U_plus_) / (epsilon * epsilon);
-      dU_dt_   = (U_plus_ - U_minus_) / (2.0 * epsilon) - c1 * d2U_dt2_;
-      U_       = U_ - c0 * d2U_dt2_;
-    }
-  } else {
-    d2U_dt2_ = (U_minus_ - 2.0 * U_ + U_plus_) / (epsilon * epsilon);
-    dU_dt_   = (U_plus_ - U_minus_) / (2.0 * epsilon);
+    state_.u[i]     = U_[i];
+    state_.du_dt[i] = dU_dt_[i];
   }
 
-  auto constrained_dofs = bcs_.allEssentialDofs();
-  state_.u.SetSubVector(constrained_dofs, 0.0);
-  U_.SetSubVectorComplement(constrained_dofs, 0.0);
-  state_.u += U_;
-
-  state_.du_dt.SetSubVector(constrained_dofs, 0.0);
-  dU_dt_.SetSubVectorComplement(constrained_dofs, 0.0);
-  state_.du_dt += dU_dt_;
-
-  // use the previous solution as our starting guess
+  // use the previous solution (or its extrapolation) as our starting guess
   d2u_dt2 = state_.d2u_dt2;
-  d2u_dt2.SetSubVector(constrained_dofs, 0.0);
-  d2U_dt2_.SetSubVectorComplement(constrained_dofs, 0.0);
-  d2u_dt2 += d2U_dt2_;
+  predictor_.Extrapolate(time, d2u_dt2);
+  for (int i : constrained_dofs) {
+    d2u_dt2[i] = d2U_dt2_[i];
+  }
+
+  if (predictor_.Type() == PredictorType::Tangent) {
+    solver_.PredictWithLastJacobian(zero_, d2u_dt2);
+  }
 
   solver_.Mult(zero_, d2u_dt2);
-  SLIC_WARNING_ROOT_IF(!solver_.NonlinearSolver().GetConverged(), "Newton Solver did not converge.");
+  if (!solver_.NonlinearSolver().GetConverged()) {
+    // adaptive time stepping retries the step with a smaller time step instead
+    SLIC_WARNING_ROOT_IF(!controller_, "Newton Solver did not converge.");
+    nonlinear_failure_ = true;
+  }
 
   state_.d2u_dt2 = d2u_dt2;
+  predictor_.Record(time, d2u_dt2);
 }
 
 FirstOrderODE::FirstOrderODE(int n, FirstOrderODE::State&& state, const EquationSolver& solver,
@@ -226,6 +366,7 @@ FirstOrderODE::FirstOrderODE(int n, FirstOrderODE::State&& state, const Equation
 
 void FirstOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
 {
+  timestepper_ = timestepper;
   switch (timestepper) {
     case serac::TimestepMethod::BackwardEuler:
       ode_solver_ = std::make_unique<mfem::BackwardEulerSolver>();
@@ -246,7 +387,7 @@ void FirstOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
       ode_solver_ = std::make_unique<mfem::RK4Solver>();
       break;
     case serac::TimestepMethod::GeneralizedAlpha:
-      ode_solver_ = std::make_unique<mfem::GeneralizedAlphaSolver>(0.5);
+      ode_solver_ = std::make_unique<mfem::GeneralizedAlphaSolver>(generalized_alpha_rho_inf);
       break;
     case serac::TimestepMethod::ImplicitMidpoint:
       ode_solver_ = std::make_unique<mfem::ImplicitMidpointSolver>();
@@ -263,6 +404,161 @@ void FirstOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
   ode_solver_->Init(*this);
 }
 
+void FirstOrderODE::SetAdaptivity(const AdaptiveTimestepOptions& options, MPI_Comm comm)
+{
+  SLIC_ERROR_ROOT_IF(!ode_solver_, "SetTimestepper must be called before SetAdaptivity");
+  controller_ = std::make_unique<TimestepController>(options, comm);
+
+  switch (timestepper_) {
+    case serac::TimestepMethod::BackwardEuler:
+    case serac::TimestepMethod::GeneralizedAlpha:
+    case serac::TimestepMethod::SDIRK23:
+      controller_->SetOrder(2);
+      break;
+    case serac::TimestepMethod::SDIRK34:
+      controller_->SetOrder(3);
+      break;
+    default:
+      SLIC_ERROR_ROOT("Adaptive time stepping is not supported by the selected first-order ODE method");
+  }
+
+  for (auto v : {&x_old_, &rate_old_, &error_, &k1_, &k2_, &k3_, &y_, &z_}) {
+    v->SetSize(height);
+  }
+}
+
+void FirstOrderODE::Step(mfem::Vector& x, double& time, double& dt)
+{
+  if (!ode_solver_) {
+    SLIC_ERROR("ode_solver_ unspecified");
+    return;
+  }
+  if (!controller_) {
+    ode_solver_->Step(x, time, dt);
+    return;
+  }
+
+  // BackwardEuler and GeneralizedAlpha estimate their error from the rate at the start of the step
+  const bool needs_start_rate =
+      (timestepper_ == TimestepMethod::BackwardEuler || timestepper_ == TimestepMethod::GeneralizedAlpha);
+
+  const double            t0     = time;
+  const double            dt_max = dt;
+  const SolutionPredictor predictor(predictor_);
+  x_old_ = x;
+
+  while (true) {
+    if (needs_start_rate && !start_rate_valid_) {
+      SetTime(t0);
+      Mult(x, rate_old_);
+      start_rate_valid_ = true;
+    }
+
+    const double h     = controller_->Proposal(dt_max);
+    nonlinear_failure_ = false;
+    EstimatedStep(x, t0, h);
+
+    bool accepted = false;
+    if (nonlinear_failure_) {
+      controller_->Cutback(h);
+    } else {
+      accepted = controller_->Accept(controller_->ErrorNorm(error_, x_old_, x), h);
+    }
+
+    if (accepted) {
+      if (timestepper_ == TimestepMethod::BackwardEuler) {
+        rate_old_ = state_.du_dt;
+      } else if (timestepper_ == TimestepMethod::GeneralizedAlpha) {
+        // the rate is updated the same way as in mfem::GeneralizedAlphaSolver
+        const double alpha_m = 0.5 * (3.0 - generalized_alpha_rho_inf) / (1.0 + generalized_alpha_rho_inf);
+        rate_old_ *= 1.0 - 1.0 / alpha_m;
+        rate_old_.Add(1.0 / alpha_m, state_.du_dt);
+      }
+      time = t0 + h;
+      dt   = h;
+      return;
+    }
+
+    // roll back to the start of the step, and discard the history the ODE solver keeps between steps, which
+    // GeneralizedAlpha recomputes from the rate at the start of the step
+    x          = x_old_;
+    predictor_ = predictor;
+    ode_solver_->Init(*this);
+    if (timestepper_ == TimestepMethod::GeneralizedAlpha) {
+      start_rate_valid_ = false;
+    }
+  }
+}
+
+void FirstOrderODE::EstimatedStep(mfem::Vector& x, double time, double dt)
+{
+  switch (timestepper_) {
+    case TimestepMethod::SDIRK23: {
+      // the stages of mfem::SDIRK23Solver, whose first stage also gives a first order solution x + dt k1
+      const double gamma = (3.0 + std::sqrt(3.0)) / 6.0;
+      SetTime(time + gamma * dt);
+      ImplicitSolve(gamma * dt, x, k1_);
+      add(x, (1.0 - 2.0 * gamma) * dt, k1_, y_);
+
+      SetTime(time + (1.0 - gamma) * dt);
+      ImplicitSolve(gamma * dt, y_, k2_);
+
+      x.Add(0.5 * dt, k1_);
+      x.Add(0.5 * dt, k2_);
+      add(0.5 * dt, k2_, -0.5 * dt, k1_, error_);
+      break;
+    }
+    case TimestepMethod::SDIRK34: {
+      // the stages of mfem::SDIRK34Solver, whose second stage also gives a second order solution x + dt k2
+      const double a = std::cos(M_PI / 18.0) / std::sqrt(3.0) + 0.5;
+      const double b = 1.0 / (6.0 * (2.0 * a - 1.0) * (2.0 * a - 1.0));
+      SetTime(time + a * dt);
+      ImplicitSolve(a * dt, x, k1_);
+      add(x, (0.5 - a) * dt, k1_, y_);
+      add(x, (2.0 * a) * dt, k1_, z_);
+
+      SetTime(time + 0.5 * dt);
+      ImplicitSolve(a * dt, y_, k2_);
+      z_.Add((1.0 - 4.0 * a) * dt, k2_);
+
+      SetTime(time + (1.0 - a) * dt);
+      ImplicitSolve(a * dt, z_, k3_);
+
+      x.Add(b * dt, k1_);
+      x.Add((1.0 - 2.0 * b) * dt, k2_);
+      x.Add(b * dt, k3_);
+      add(k1_, k3_, error_);
+      error_.Add(-2.0, k2_);
+      error_ *= b * dt;
+      break;
+    }
+    case TimestepMethod::BackwardEuler: {
+      double t_end = time;
+      double h     = dt;
+      ode_solver_->Step(x, t_end, h);
+      // the difference to the trapezoidal rule with the same rates
+      add(0.5 * dt, state_.du_dt, -0.5 * dt, rate_old_, error_);
+      break;
+    }
+    case TimestepMethod::GeneralizedAlpha: {
+      double t_end = time;
+      double h     = dt;
+      ode_solver_->Step(x, t_end, h);
+      // the update is x + dt ((1 - gamma) v_n + gamma v_{n+1}), which differs from the trapezoidal rule by
+      // dt (gamma - 1/2) (v_{n+1} - v_n), with v_{n+1} - v_n = (k - v_n) / alpha_m for the solved stage k
+      const double rho     = generalized_alpha_rho_inf;
+      const double alpha_m = 0.5 * (3.0 - rho) / (1.0 + rho);
+      const double alpha_f = 1.0 / (1.0 + rho);
+      const double gamma   = 0.5 + alpha_m - alpha_f;
+      add(state_.du_dt, -1.0, rate_old_, error_);
+      error_ *= dt * (gamma - 0.5) / alpha_m;
+      break;
+    }
+    default:
+      SLIC_ERROR_ROOT("Adaptive time stepping is not supported by the selected first-order ODE method");
+  }
+}
+
 void FirstOrderODE::Solve(const double dt, const mfem::Vector& u, mfem::Vector& du_dt) const
 {
   // assign these values to variables with greater scope,
@@ -270,54 +566,198 @@ void FirstOrderODE::Solve(const double dt, const mfem::Vector& u, mfem::Vector&
   state_.dt = dt;
   state_.u  = u;
 
-  // evaluate the constraint functions at a 3-point
-  // stencil of times centered on the time of interest
-  // in order to compute finite-difference approximations
-  // to the time derivatives that appear in the residual
-  U_minus_ = 0.0;
-  U_       = 0.0;
-  U_plus_  = 0.0;
-  for (const auto& bc : bcs_.essentials()) {
-    bc.projectBdrToDofs(U_minus_, t - epsilon);
-    bc.projectBdrToDofs(U_, t);
-    bc.projectBdrToDofs(U_plus_, t + epsilon);
-  }
+  // evaluate the constraint functions and the time derivatives
+  // that appear in the residual at the constrained dofs only
+  const bool implicit = (dt != 0.0);
+  const bool direct   = implicit && enforcement_method_ == DirichletEnforcementMethod::DirectControl;
+  evaluateConstraints(bcs_, t, epsilon, U_, direct ? nullptr : &dU_dt_, nullptr, U_minus_, U_plus_);
+
+  const auto& constrained_dofs = bcs_.allEssentialDofs();
+  for (int i : constrained_dofs) {
+    if (implicit) {
+      if (enforcement_method_ == DirichletEnforcementMethod::DirectControl) {
+        dU_dt_[i] = (U_[i] - u[i]) / dt;
+        U_[i]     = u[i];
+      }
 
-  bool implicit = (dt != 0.0);
-  if (implicit) {
-    if (enforcement_method_ == DirichletEnforcementMethod::DirectControl) {
-      dU_dt_ = (U_ - u) / dt;
-      U_     = u;
-    }
+      if (enforcement_method_ == DirichletEnforcementMethod::RateControl) {
+        U_[i] = u[i];
+      }
 
-    if (enforcement_method_ == DirichletEnforcementMethod::RateControl) {
-      dU_dt_ = (U_plus_ - U_minus_) / (2.0 * epsilon);
-      U_     = u;
+      if (enforcement_method_ == DirichletEnforcementMethod::FullControl) {
+        U_[i] -= dt * dU_dt_[i];
+      }
     }
 
-    if (enforcement_method_ == DirichletEnforcementMethod::FullControl) {
-      dU_dt_ = (U_plus_ - U_minus_) / (2.0 * epsilon);
-      U_     = U_ - dt * dU_dt_;
-    }
-  } else {
-    dU_dt_ = (U_plus_ - U_minus_) / (2.0 * epsilon);
+    state_.u[i] = U_[i];
   }
 
-  auto constrained_dofs = bcs_.allEssentialDofs();
-  state_.u.SetSubVector(constrained_dofs, 0.0);
-  U_.SetSubVectorComplement(constrained_dofs, 0.0);
-  state_.u += U_;
-
+  // use the previous solution (or its extrapolation) as our starting guess
   du_dt = state_.du_dt;
-  du_dt.SetSubVector(constrained_dofs, 0.0);
-  dU_dt_.SetSubVectorComplement(constrained_dofs, 0.0);
-  du_dt += dU_dt_;
+  predictor_.Extrapolate(t, du_dt);
+  for (int i : constrained_dofs) {
+    du_dt[i] = dU_dt_[i];
+  }
+
+  if (predictor_.Type() == PredictorType::Tangent) {
+    solver_.PredictWithLastJacobian(zero_, du_dt);
+  }
 
   solver_.Mult(zero_, du_dt);
-  SLIC_WARNING_ROOT_IF(!solver_.NonlinearSolver().GetConverged(), "Newton Solver did not converge.");
+  if (!solver_.NonlinearSolver().GetConverged()) {
+    // adaptive time stepping retries the step with a smaller time step instead
+    SLIC_WARNING_ROOT_IF(!controller_, "Newton Solver did not converge.");
+    nonlinear_failure_ = true;
+  }
 
   state_.du_dt       = du_dt;
   state_.previous_dt = dt;
+  predictor_.Record(t, du_dt);
+}
+
+LumpedMassFirstOrderODE::LumpedMassFirstOrderODE(int                                                             n,
+                                                 std::function<void(double, const mfem::Vector&, mfem::Vector&)> f,
+                                                 const BoundaryConditionManager& bcs)
+    : mfem::TimeDependentOperator(n, 0.0), f_(std::move(f)), bcs_(bcs)
+{
+  u_.SetSize(n);
+  U_minus_.SetSize(n);
+  U_.SetSize(n);
+  U_plus_.SetSize(n);
+  dU_dt_.SetSize(n);
+  SetTimestepper(timestepper_);
+}
+
+void LumpedMassFirstOrderODE::SetTimestepper(const serac::TimestepMethod timestepper)
+{
+  timestepper_ = timestepper;
+  switch (timestepper) {
+    case serac::TimestepMethod::ForwardEuler:
+      ode_solver_ = std::make_unique<mfem::ForwardEulerSolver>();
+      break;
+    case serac::TimestepMethod::RK2:
+      ode_solver_ = std::make_unique<mfem::RK2Solver>(0.5);
+      break;
+    case serac::TimestepMethod::RK3SSP:
+      ode_solver_ = std::make_unique<mfem::RK3SSPSolver>();
+      break;
+    case serac::TimestepMethod::RK4:
+      ode_solver_ = std::make_unique<mfem::RK4Solver>();
+      break;
+    default:
+      SLIC_ERROR_ROOT("The lumped mass matrix requires an explicit Runge-Kutta timestepper");
+  }
+  ode_solver_->Init(*this);
+}
+
+void LumpedMassFirstOrderODE::SetLumpedMass(const mfem::Vector& lumped_mass)
+{
+  inv_lumped_mass_ = lumped_mass;
+  inv_lumped_mass_.Reciprocal();
+}
+
+double LumpedMassFirstOrderODE::StableTimestep() const
+{
+  SLIC_ERROR_ROOT_IF(spectral_radius_ <= 0.0, "The spectral radius must be set to find the stable time step");
+
+  // the extent of each method's stability region along the negative real axis
+  double stability_radius = 2.0;
+  if (timestepper_ == TimestepMethod::RK3SSP) {
+    stability_radius = 2.5127;
+  } else if (timestepper_ == TimestepMethod::RK4) {
+    stability_radius = 2.7853;
+  }
+  return stability_radius / spectral_radius_;
+}
+
+void LumpedMassFirstOrderODE::Mult(const mfem::Vector& u, mfem::Vector& du_dt) const
+{
+  const auto& constrained_dofs = bcs_.allEssentialDofs();
+  evaluateConstraints(bcs_, t, epsilon, U_, &dU_dt_, nullptr, U_minus_, U_plus_);
+
+  u_ = u;
+  for (int i : constrained_dofs) {
+    u_[i] = U_[i];
+  }
+
+  f_(t, u_, du_dt);
+  for (int i = 0; i < du_dt.Size(); i++) {
+    du_dt[i] *= -inv_lumped_mass_[i];
+  }
+  for (int i : constrained_dofs) {
+    du_dt[i] = dU_dt_[i];
+  }
+}
+
+void LumpedMassFirstOrderODE::Step(mfem::Vector& x, double& time, double dt)
+{
+  SLIC_ERROR_ROOT_IF(inv_lumped_mass_.Size() != x.Size(), "The lumped mass matrix must be set before stepping");
+
+  const int    substeps = std::max(1, static_cast<int>(std::ceil(dt / (stability_safety * StableTimestep()))));
+  const double substep  = dt / substeps;
+
+  // the stages are evaluated at their own times, so the caller's time is only advanced at the end
+  double t_local = time;
+  for (int i = 0; i < substeps; i++) {
+    double h = substep;
+    ode_solver_->Step(x, t_local, h);
+  }
+
+  for (const auto& bc : bcs_.essentials()) {
+    bc.projectBdrToDofs(x, t_local);
+  }
+  time = t_local;
+}
+
+void LumpedMass(const mfem::Operator& M, MPI_Comm comm, mfem::Vector& lumped_mass, mfem::Vector& inv_lumped_mass)
+{
+  mfem::Vector ones(M.Width());
+  ones = 1.0;
+  lumped_mass.SetSize(M.Height());
+  M.Mult(ones, lumped_mass);
+
+  double min_mass = lumped_mass.Min();
+  MPI_Allreduce(MPI_IN_PLACE, &min_mass, 1, MPI_DOUBLE, MPI_MIN, comm);
+  SLIC_ERROR_ROOT_IF(min_mass <= 0.0,
+                     "The row-summed lumped mass matrix is not positive, which happens with some higher order "
+                     "simplex elements. Use a consistent mass matrix for this discretization.");
+
+  inv_lumped_mass = lumped_mass;
+  inv_lumped_mass.Reciprocal();
+}
+
+double LumpedSpectralRadiusBound(const mfem::HypreParMatrix& K, const mfem::Vector& inv_lumped_mass,
+                                 const mfem::Array<int>& constrained_dofs)
+{
+  mfem::SparseMatrix diag, offd;
+  HYPRE_BigInt*      cmap;
+  K.GetDiag(diag);
+  K.GetOffd(offd, cmap);
+
+  mfem::Array<int> constrained(inv_lumped_mass.Size());
+  constrained = 0;
+  for (int i : constrained_dofs) {
+    constrained[i] = 1;
+  }
+
+  double bound = 0.0;
+  for (int row = 0; row < diag.Height(); row++) {
+    if (constrained[row]) {
+      continue;
+    }
+    double row_sum = 0.0;
+    for (int k = diag.GetI()[row]; k < diag.GetI()[row + 1]; k++) {
+      row_sum += std::abs(diag.GetData()[k]);
+    }
+    if (offd.Height() > 0) {
+      for (int k = offd.GetI()[row]; k < offd.GetI()[row + 1]; k++) {
+        row_sum += std::abs(offd.GetData()[k]);
+      }
+    }
+    bound = std::max(bound, row_sum * inv_lumped_mass[row]);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, &bound, 1, MPI_DOUBLE, MPI_MAX, K.GetComm());
+  return bound;
 }
 
 }  // namespace serac::mfem_ext
@@ -18,6 +18,8 @@
 
 #include "serac/physics/boundary_conditions/boundary_condition_manager.hpp"
 #include "serac/numerics/equation_solver.hpp"
+#include "serac/numerics/solution_predictor.hpp"
+#include "serac/numerics/timestep_controller.hpp"
 
 namespace serac::mfem_ext {
 
@@ -35,7 +37,8 @@ class SecondOrderODE : public mfem::SecondOrderTimeDependentOperator {
 public:
   /**
    * @brief a small number used to compute finite difference approximations
-   * to time derivatives of boundary conditions.
+   * to time derivatives of boundary conditions, for boundary conditions that
+   * do not supply them analytically (see BoundaryCondition::setTimeDerivatives).
    *
    * Note: this is intended to be temporary
    * Ideally, epsilon should be "small" relative to the characteristic
@@ -134,6 +137,12 @@ public:
    */
   void SetEnforcementMethod(const DirichletEnforcementMethod method) { enforcement_method_ = method; }
 
+  /**
+   * @brief Configures the initial guess of each nonlinear solve
+   * @param[in] predictor The selected predictor
+   */
+  void SetPredictor(const PredictorType predictor) { predictor_.SetType(predictor); }
+
   /**
    * @brief Set the time integration method
    *
@@ -141,13 +150,34 @@ public:
    */
   void SetTimestepper(const serac::TimestepMethod timestepper);
 
+  /**
+   * @brief Enables error-controlled adaptive time stepping
+   *
+   * The local error of the Newmark-family methods is estimated from the change of the acceleration over the step,
+   * dt^2 |beta - 1/6| (a_{n+1} - a_n) (Zienkiewicz and Xie, 1991), and that of BackwardEuler from the change of
+   * the velocity, dt / 2 (v_{n+1} - v_n). LinearAcceleration (beta = 1/6) is not supported. HHTAlpha and WBZAlpha
+   * are created by SetTimestepper with their default parameters (rho_inf = 1), for which they reduce to the
+   * trapezoidal rule, beta = 1/4; the estimate does not hold for other choices of their parameters.
+   *
+   * @param[in] options The adaptivity parameters
+   * @param[in] comm The MPI communicator the solution is distributed over
+   * @pre SetTimestepper must be called first
+   */
+  void SetAdaptivity(const AdaptiveTimestepOptions& options, MPI_Comm comm);
+
+  /**
+   * @brief The step size controller, or nullptr if the time steps are fixed
+   */
+  const TimestepController* Controller() const { return controller_.get(); }
+
   /**
    * @brief Performs a time step
    *
    * @param[inout] x The predicted solution
    * @param[inout] dxdt The predicted rate
    * @param[inout] time The current time
-   * @param[inout] dt The desired time step
+   * @param[inout] dt The desired time step. With adaptive time stepping, this is the largest step allowed on input,
+   * and the step that was taken on output.
    *
    * @see mfem::SecondOrderODESolver::Step
    */
@@ -171,14 +201,31 @@ private:
   void Solve(const double time, const double c0, const double c1, const mfem::Vector& u, const mfem::Vector& du_dt,
              mfem::Vector& d2u_dt2) const;
 
+  /**
+   * @brief Performs a time step with the selected method, without error control
+   * @param[inout] x The predicted solution
+   * @param[inout] dxdt The predicted rate
+   * @param[inout] time The current time
+   * @param[in] dt The time step
+   */
+  void FixedStep(mfem::Vector& x, mfem::Vector& dxdt, double& time, double dt);
+
   /**
    * @brief Set of references to external variables used by residual operator
    */
   State state_;
+  /**
+   * @brief The selected time integration method
+   */
+  TimestepMethod timestepper_ = TimestepMethod::Newmark;
   /**
    * @brief The method of enforcing time-varying dirichlet boundary conditions
    */
   DirichletEnforcementMethod enforcement_method_ = serac::DirichletEnforcementMethod::RateControl;
+  /**
+   * @brief The initial guess of each nonlinear solve, predicted from the previous solutions
+   */
+  mutable SolutionPredictor predictor_;
   /**
    * @brief Reference to the equationsolver used to solve for d2u_dt2
    */
@@ -193,6 +240,16 @@ private:
    */
   std::unique_ptr<mfem::ODESolver> first_order_system_ode_solver_;
 
+  /**
+   * @brief Preallocated storage of the displacement and velocity stepped by first_order_system_ode_solver_
+   */
+  mfem::Vector first_order_system_;
+
+  /**
+   * @brief Working vector for the predicted displacement of first order system steps
+   */
+  mfem::Vector u_next_;
+
   /**
    * @brief Reference to boundary conditions used to constrain the solution
    */
@@ -200,13 +257,35 @@ private:
   mfem::Vector                    zero_;
 
   /**
-   * @brief Working vectors for ODE outputs prior to constraint enforcement
+   * @brief Working vectors for ODE outputs prior to constraint enforcement,
+   * only the entries of constrained dofs are used
    */
   mutable mfem::Vector U_minus_;
   mutable mfem::Vector U_;
   mutable mfem::Vector U_plus_;
   mutable mfem::Vector dU_dt_;
   mutable mfem::Vector d2U_dt2_;
+
+  /**
+   * @brief The step size controller of adaptive time stepping
+   */
+  std::unique_ptr<TimestepController> controller_;
+  /**
+   * @brief The Newmark parameter beta of the selected method, which scales the error estimate
+   */
+  double newmark_beta_ = 0.25;
+  /**
+   * @brief Whether a nonlinear solve failed since this flag was last reset
+   */
+  mutable bool nonlinear_failure_ = false;
+  /**
+   * @brief Whether accel_old_ holds the acceleration at the start of the next step
+   */
+  bool start_rate_valid_ = false;
+  /**
+   * @brief The solution, rate and acceleration at the start of an adaptive step, and its error estimate
+   */
+  mfem::Vector x_old_, v_old_, accel_old_, error_;
 };
 
 /**
@@ -223,7 +302,8 @@ class FirstOrderODE : public mfem::TimeDependentOperator {
 public:
   /**
    * @brief a small number used to compute finite difference approximations
-   * to time derivatives of boundary conditions.
+   * to time derivatives of boundary conditions, for boundary conditions that
+   * do not supply them analytically (see BoundaryCondition::setTimeDerivatives).
    *
    * Note: this is intended to be temporary
    * Ideally, epsilon should be "small" relative to the characteristic
@@ -301,6 +381,12 @@ public:
    */
   void SetEnforcementMethod(const DirichletEnforcementMethod method) { enforcement_method_ = method; }
 
+  /**
+   * @brief Configures the initial guess of each nonlinear solve
+   * @param[in] predictor The selected predictor
+   */
+  void SetPredictor(const PredictorType predictor) { predictor_.SetType(predictor); }
+
   /**
    * @brief Set the time integration method
    *
@@ -308,23 +394,35 @@ public:
    */
   void SetTimestepper(const serac::TimestepMethod timestepper);
 
+  /**
+   * @brief Enables error-controlled adaptive time stepping
+   *
+   * SDIRK23 and SDIRK34 estimate the local error with embedded first and second order solutions computed from
+   * their own stages. BackwardEuler and GeneralizedAlpha estimate it from the change of the rate over the step,
+   * by comparison with the trapezoidal rule.
+   *
+   * @param[in] options The adaptivity parameters
+   * @param[in] comm The MPI communicator the solution is distributed over
+   * @pre SetTimestepper must be called first
+   */
+  void SetAdaptivity(const AdaptiveTimestepOptions& options, MPI_Comm comm);
+
+  /**
+   * @brief The step size controller, or nullptr if the time steps are fixed
+   */
+  const TimestepController* Controller() const { return controller_.get(); }
+
   /**
    * @brief Performs a time step
    *
    * @param[inout] x The predicted solution
    * @param[inout] time The current time
-   * @param[inout] dt The desired time step
+   * @param[inout] dt The desired time step. With adaptive time stepping, this is the largest step allowed on input,
+   * and the step that was taken on output.
    *
    * @see mfem::ODESolver::Step
    */
-  void Step(mfem::Vector& x, double& time, double& dt)
-  {
-    if (ode_solver_) {
-      ode_solver_->Step(x, time, dt);
-    } else {
-      SLIC_ERROR("ode_solver_ unspecified");
-    }
-  }
+  void Step(mfem::Vector& x, double& time, double& dt);
 
   /**
    * @brief Internal implementation used for mfem::TDO::Mult and mfem::TDO::ImplicitSolve
@@ -335,15 +433,32 @@ public:
   virtual void Solve(const double dt, const mfem::Vector& u, mfem::Vector& du_dt) const;
 
 private:
+  /**
+   * @brief Performs a time step with the selected method, and estimates its local error
+   * @param[inout] x The solution
+   * @param[in] time The time at the start of the step
+   * @param[in] dt The time step
+   */
+  void EstimatedStep(mfem::Vector& x, double time, double dt);
+
   /**
    * @brief Set of references to external variables used by residual operator
    */
   FirstOrderODE::State state_;
 
+  /**
+   * @brief The selected time integration method
+   */
+  TimestepMethod timestepper_ = TimestepMethod::BackwardEuler;
+
   /**
    * @brief The method of enforcing time-varying dirichlet boundary conditions
    */
   DirichletEnforcementMethod enforcement_method_ = serac::DirichletEnforcementMethod::RateControl;
+  /**
+   * @brief The initial guess of each nonlinear solve, predicted from the previous solutions
+   */
+  mutable SolutionPredictor predictor_;
   /**
    * @brief Reference to the equationsolver used to solve for du_dt
    */
@@ -359,12 +474,173 @@ private:
   mfem::Vector                    zero_;
 
   /**
-   * @brief Working vectors for ODE outputs prior to constraint enforcement
+   * @brief Working vectors for ODE outputs prior to constraint enforcement,
+   * only the entries of constrained dofs are used
    */
   mutable mfem::Vector U_minus_;
   mutable mfem::Vector U_;
   mutable mfem::Vector U_plus_;
   mutable mfem::Vector dU_dt_;
+
+  /**
+   * @brief The step size controller of adaptive time stepping
+   */
+  std::unique_ptr<TimestepController> controller_;
+  /**
+   * @brief Whether a nonlinear solve failed since this flag was last reset
+   */
+  mutable bool nonlinear_failure_ = false;
+  /**
+   * @brief Whether rate_old_ holds the rate at the start of the next step
+   */
+  bool start_rate_valid_ = false;
+  /**
+   * @brief The solution and rate at the start of an adaptive step, and its error estimate
+   */
+  mfem::Vector x_old_, rate_old_, error_;
+  /**
+   * @brief The stages and intermediate solutions of the SDIRK methods
+   */
+  mfem::Vector k1_, k2_, k3_, y_, z_;
+};
+
+/**
+ * @brief LumpedMassFirstOrderODE integrates the first order system M du_dt + f(u, t) = 0 with a diagonal
+ *   (lumped) mass matrix M using MFEM's explicit Runge-Kutta methods
+ *
+ * Each stage is a single evaluation of f and a diagonal scaling, without any linear or nonlinear solves.
+ * Steps longer than the stability limit of the method are subcycled.
+ */
+class LumpedMassFirstOrderODE : public mfem::TimeDependentOperator {
+public:
+  /**
+   * @brief a small number used to compute finite difference approximations
+   * to time derivatives of boundary conditions that do not supply them analytically
+   */
+  static constexpr double epsilon = 0.000001;
+
+  /**
+   * @brief The fraction of the stable time step taken by the subcycles
+   */
+  static constexpr double stability_safety = 0.9;
+
+  /**
+   * @brief Constructor defining the size and the system of ordinary differential equations to be solved
+   *
+   * @param[in] n The number of components in each vector of the ODE
+   * @param[in] f Evaluates f(u, t) given the stage time and the stage solution, whose constrained
+   *   entries hold the boundary values at the stage time. The entries of constrained dofs are ignored.
+   * @param[in] bcs The set of Dirichlet conditions to enforce
+   */
+  LumpedMassFirstOrderODE(int n, std::function<void(double, const mfem::Vector&, mfem::Vector&)> f,
+                          const BoundaryConditionManager& bcs);
+
+  /**
+   * @brief Set the time integration method
+   *
+   * @param[in] timestepper One of ForwardEuler, RK2, RK3SSP or RK4
+   */
+  void SetTimestepper(const serac::TimestepMethod timestepper);
+
+  /**
+   * @brief Set the diagonal of the lumped mass matrix
+   *
+   * @param[in] lumped_mass The diagonal entries, which must be positive
+   */
+  void SetLumpedMass(const mfem::Vector& lumped_mass);
+
+  /**
+   * @brief Set an upper bound of the spectral radius of M^-1 df/du, which limits the stable time step
+   *
+   * @param[in] spectral_radius The bound, see LumpedSpectralRadiusBound
+   */
+  void SetSpectralRadius(double spectral_radius) { spectral_radius_ = spectral_radius; }
+
+  /**
+   * @brief The largest stable step of the selected method, from the spectral radius bound
+   */
+  double StableTimestep() const;
+
+  /**
+   * @brief Evaluates du_dt = -M^-1 f(u, t), with the boundary condition rates at the constrained dofs
+   *
+   * @param[in] u The stage solution
+   * @param[out] du_dt The time derivative of the stage solution
+   */
+  void Mult(const mfem::Vector& u, mfem::Vector& du_dt) const override;
+
+  /**
+   * @brief Performs a time step, subcycled so that each subcycle is stable
+   *
+   * @param[inout] x The predicted solution
+   * @param[inout] time The current time
+   * @param[in] dt The time step to take
+   */
+  void Step(mfem::Vector& x, double& time, double dt);
+
+private:
+  /**
+   * @brief Evaluates f(u, t)
+   */
+  std::function<void(double, const mfem::Vector&, mfem::Vector&)> f_;
+
+  /**
+   * @brief Reference to boundary conditions used to constrain the solution
+   */
+  const BoundaryConditionManager& bcs_;
+
+  /**
+   * @brief The selected time integration method
+   */
+  TimestepMethod timestepper_ = TimestepMethod::ForwardEuler;
+
+  /**
+   * @brief MFEM solver object for first-order ODEs
+   */
+  std::unique_ptr<mfem::ODESolver> ode_solver_;
+
+  /**
+   * @brief The inverse of the diagonal of the lumped mass matrix
+   */
+  mfem::Vector inv_lumped_mass_;
+
+  /**
+   * @brief An upper bound of the spectral radius of M^-1 df/du
+   */
+  double spectral_radius_ = 0.0;
+
+  /**
+   * @brief Working vectors for the constrained stage solution, and the boundary condition values and rates
+   */
+  mutable mfem::Vector u_, U_minus_, U_, U_plus_, dU_dt_;
 };
 
+/**
+ * @brief Computes the row-summed lumped mass matrix of a mass operator, and its inverse
+ *
+ * The row sums are the action of the mass operator on a vector of ones, so only its action is required.
+ *
+ * @param[in] M The mass operator
+ * @param[in] comm The MPI communicator the mass operator is distributed over
+ * @param[out] lumped_mass The diagonal of the lumped mass matrix
+ * @param[out] inv_lumped_mass The inverse of the diagonal of the lumped mass matrix
+ * @note Errors out on all ranks when a row sum is not positive
+ */
+void LumpedMass(const mfem::Operator& M, MPI_Comm comm, mfem::Vector& lumped_mass, mfem::Vector& inv_lumped_mass);
+
+/**
+ * @brief An upper bound of the spectral radius of M^-1 K for a diagonal (lumped) mass matrix M,
+ *   from the Gerschgorin row sums of K
+ *
+ * This bounds the highest frequency of a discretization, and hence the stable step of explicit time integration,
+ * using only the assembled tangent and the lumped mass, without knowledge of the wave speeds of the material.
+ *
+ * @param[in] K The assembled tangent
+ * @param[in] inv_lumped_mass The inverse of the diagonal of the lumped mass matrix
+ * @param[in] constrained_dofs The constrained dofs, whose rows are excluded
+ * @return The bound, reduced over all ranks of K's communicator
+ */
+double LumpedSpectralRadiusBound(const mfem::HypreParMatrix& K, const mfem::Vector& inv_lumped_mass,
+                                 const mfem::Array<int>& constrained_dofs);
+
 }  // namespace serac::mfem_ext
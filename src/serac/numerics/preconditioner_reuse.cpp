@@ -0,0 +1,87 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/preconditioner_reuse.hpp"
+
+#include "serac/infrastructure/logger.hpp"
+#include "serac/numerics/element_preconditioner.hpp"
+
+namespace serac::mfem_ext {
+
+void FrozenHierarchyAMG::RefreshFineMatrix(const mfem::HypreParMatrix& matrix)
+{
+  SLIC_ERROR_ROOT_IF(A == nullptr, "The AMG hierarchy must be built before its fine-level matrix can be refreshed");
+  SLIC_ERROR_ROOT_IF(matrix.GetGlobalNumRows() != A->GetGlobalNumRows() ||
+                         matrix.GetGlobalNumCols() != A->GetGlobalNumCols(),
+                     "Refreshed fine-level matrix does not match the frozen AMG hierarchy");
+  // the setup phase is not repeated, as setup_called is left unchanged, so the coarse operators and the
+  // fine-level smoother data (e.g. l1 row norms) computed from the previous matrix are kept
+  A = const_cast<mfem::HypreParMatrix*>(&matrix);
+}
+
+ReusablePreconditioner::ReusablePreconditioner(std::unique_ptr<mfem::Solver> prec, const mfem::IterativeSolver& solver,
+                                               const PreconditionerReuseOptions& options)
+    : prec_(std::move(prec)), solver_(solver), options_(options)
+{
+  prec_->iterative_mode = false;
+  // the element preconditioner is factored from its own processor-local matrix, and only reads the size of the
+  // operator it is given, so there is no need to keep that operator alive between rebuilds
+  keep_operator_ = !dynamic_cast<ElementSchwarzPreconditioner*>(prec_.get());
+  if (options_.freeze_amg_hierarchy) {
+    frozen_amg_ = dynamic_cast<FrozenHierarchyAMG*>(prec_.get());
+    SLIC_WARNING_ROOT_IF(!frozen_amg_, "Freezing the AMG hierarchy has no effect with a non-AMG preconditioner");
+  }
+}
+
+bool ReusablePreconditioner::ShouldRebuild() const
+{
+  if (needs_rebuild_) {
+    return true;
+  }
+  if (options_.rebuild_on_new_step && new_step_) {
+    return true;
+  }
+  if (options_.rebuild_interval > 0 && updates_since_rebuild_ >= options_.rebuild_interval) {
+    return true;
+  }
+  // the linear solver still reports the statistics of the solve that used the current preconditioner
+  if (options_.max_linear_iterations > 0 &&
+      (!solver_.GetConverged() || solver_.GetNumIterations() > options_.max_linear_iterations)) {
+    return true;
+  }
+  return false;
+}
+
+void ReusablePreconditioner::SetOperator(const mfem::Operator& op)
+{
+  height = op.Height();
+  width  = op.Width();
+
+  auto matrix = dynamic_cast<const mfem::HypreParMatrix*>(&op);
+
+  if (ShouldRebuild()) {
+    if (matrix && keep_operator_ && !frozen_amg_) {
+      // HypreParMatrix's copy constructor makes a deep copy
+      built_from_ = std::make_unique<mfem::HypreParMatrix>(*matrix);
+      prec_->SetOperator(*built_from_);
+    } else {
+      prec_->SetOperator(op);
+    }
+    needs_rebuild_         = false;
+    updates_since_rebuild_ = 0;
+    num_rebuilds_++;
+  } else if (frozen_amg_) {
+    SLIC_ERROR_ROOT_IF(!matrix, "A frozen AMG hierarchy can only be refreshed with a HypreParMatrix");
+    frozen_amg_->RefreshFineMatrix(*matrix);
+  }
+
+  new_step_ = false;
+  updates_since_rebuild_++;
+}
+
+void ReusablePreconditioner::Mult(const mfem::Vector& r, mfem::Vector& z) const { prec_->Mult(r, z); }
+
+}  // namespace serac::mfem_ext
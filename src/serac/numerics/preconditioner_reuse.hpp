@@ -0,0 +1,141 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file preconditioner_reuse.hpp
+ *
+ * @brief Wrappers that let an expensive preconditioner be reused across operator updates
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief A BoomerAMG preconditioner whose coarse hierarchy can be kept while the fine-level
+ * operator is replaced
+ *
+ * hypre computes the fine-level residual and sweeps the fine-level smoother over the matrix passed
+ * to each solve, so swapping that matrix without redoing the setup phase gives a preconditioner for
+ * the new operator built on the old coarse spaces. Only the matrix itself is swapped: everything else
+ * hypre computed during setup stays frozen, including the coarse operators and the fine-level smoother
+ * data (e.g. the l1 row norms that scale the default l1-Gauss-Seidel smoother). The refreshed
+ * preconditioner therefore degrades as the operator drifts away from the one it was built from, and
+ * should be combined with a rebuild criterion when the operator can change significantly.
+ */
+class FrozenHierarchyAMG : public mfem::HypreBoomerAMG {
+public:
+  using mfem::HypreBoomerAMG::HypreBoomerAMG;
+
+  /**
+   * @brief Replaces the fine-level operator without recomputing the coarse hierarchy
+   * @param[in] matrix The new fine-level operator, which must have the same parallel layout as the old one
+   * @note The matrix must outlive any subsequent calls to Mult
+   * @note The smoother data computed at setup from the previous matrix is not recomputed
+   */
+  void RefreshFineMatrix(const mfem::HypreParMatrix& matrix);
+};
+
+/**
+ * @brief Wraps a preconditioner and only forwards operator updates to it when the reuse policy
+ * calls for a rebuild
+ *
+ * When the preconditioner is reused, it is applied as it was built from the operator of the last
+ * rebuild (a copy of that operator is kept, since callers typically destroy their Jacobians between
+ * Newton iterations), unless the wrapped preconditioner is a FrozenHierarchyAMG and the hierarchy
+ * is frozen, in which case only its fine-level operator is refreshed. No copy is made for
+ * preconditioners that do not read the operator, such as ElementSchwarzPreconditioner.
+ */
+class ReusablePreconditioner : public mfem::Solver {
+public:
+  /**
+   * @brief Constructs the wrapper
+   * @param[in] prec The preconditioner to wrap
+   * @param[in] solver The linear solver being preconditioned, queried for its iteration counts
+   * @param[in] options The reuse policy
+   */
+  ReusablePreconditioner(std::unique_ptr<mfem::Solver> prec, const mfem::IterativeSolver& solver,
+                         const PreconditionerReuseOptions& options);
+
+  /**
+   * @brief Updates the operator, rebuilding the wrapped preconditioner if the reuse policy calls for it
+   * @param[in] op The new operator
+   * @note Implements mfem::Operator::SetOperator
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Applies the wrapped preconditioner
+   * @param[in] r The input vector
+   * @param[out] z The preconditioned vector
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& r, mfem::Vector& z) const override;
+
+  /**
+   * @brief Signals that subsequent operator updates belong to a new solve (e.g. time step)
+   */
+  void NewStep() { new_step_ = true; }
+
+  /**
+   * @brief Forces a rebuild on the next operator update
+   */
+  void Invalidate() { needs_rebuild_ = true; }
+
+  /**
+   * @brief The number of times the wrapped preconditioner has been rebuilt
+   */
+  int NumRebuilds() const { return num_rebuilds_; }
+
+  /**
+   * @brief The wrapped preconditioner
+   */
+  mfem::Solver& Preconditioner() { return *prec_; }
+
+private:
+  /**
+   * @brief Whether the policy calls for a rebuild on this operator update
+   */
+  bool ShouldRebuild() const;
+
+  /// @brief The wrapped preconditioner
+  std::unique_ptr<mfem::Solver> prec_;
+
+  /// @brief The linear solver being preconditioned
+  const mfem::IterativeSolver& solver_;
+
+  /// @brief The reuse policy
+  PreconditionerReuseOptions options_;
+
+  /// @brief The wrapped AMG preconditioner, if its hierarchy is to be frozen between rebuilds
+  FrozenHierarchyAMG* frozen_amg_ = nullptr;
+
+  /// @brief The operator the wrapped preconditioner was last built from, when it must be kept alive
+  std::unique_ptr<mfem::HypreParMatrix> built_from_;
+
+  /// @brief Whether the wrapped preconditioner reads the operator it is built from, which must then be kept alive
+  bool keep_operator_ = true;
+
+  /// @brief Whether a rebuild is required regardless of the policy (e.g. nothing has been built yet)
+  bool needs_rebuild_ = true;
+
+  /// @brief Whether a new step has started since the last operator update
+  bool new_step_ = true;
+
+  /// @brief The number of operator updates since the last rebuild
+  int updates_since_rebuild_ = 0;
+
+  /// @brief The number of rebuilds so far
+  int num_rebuilds_ = 0;
+};
+
+}  // namespace serac::mfem_ext
@@ -0,0 +1,204 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/recycling_solver.hpp"
+
+#include <algorithm>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac::mfem_ext {
+
+RecyclingKrylovSolver::RecyclingKrylovSolver(MPI_Comm comm, std::unique_ptr<mfem::IterativeSolver> solver,
+                                             int recycle_dim, bool symmetric)
+    : mfem::IterativeSolver(comm),
+      solver_(std::move(solver)),
+      recycle_dim_(recycle_dim),
+      symmetric_(symmetric),
+      projected_(*this)
+{
+  SLIC_ERROR_ROOT_IF(recycle_dim_ < 1, "The recycled subspace must have a positive dimension");
+  solver_->iterative_mode = false;
+}
+
+void RecyclingKrylovSolver::SetOperator(const mfem::Operator& op)
+{
+  oper   = &op;
+  height = op.Height();
+  width  = op.Width();
+  if (prec) {
+    prec->SetOperator(op);
+  }
+
+  // A new discretization invalidates the recycled subspace, a new operator only its projection
+  if (!U_.empty() && U_.front().Size() != width) {
+    ClearRecycledSpace();
+  }
+  projection_valid_ = false;
+
+  projected_.Resize(height, width);
+  solver_->SetOperator(projected_);
+}
+
+void RecyclingKrylovSolver::SetPreconditioner(mfem::Solver& pr)
+{
+  mfem::IterativeSolver::SetPreconditioner(pr);
+  prec_proxy_.prec = &pr;
+  solver_->SetPreconditioner(prec_proxy_);
+}
+
+void RecyclingKrylovSolver::ClearRecycledSpace()
+{
+  U_.clear();
+  AU_.clear();
+  projection_valid_ = false;
+}
+
+void RecyclingKrylovSolver::UpdateProjection() const
+{
+  if (projection_valid_) {
+    return;
+  }
+
+  const int k = RecycledDimension();
+  AU_.resize(static_cast<std::size_t>(k));
+  for (int i = 0; i < k; i++) {
+    AU_[static_cast<std::size_t>(i)].SetSize(height);
+    oper->Mult(U_[static_cast<std::size_t>(i)], AU_[static_cast<std::size_t>(i)]);
+  }
+
+  E_inv_.SetSize(k);
+  for (int i = 0; i < k; i++) {
+    const auto& z = symmetric_ ? U_[static_cast<std::size_t>(i)] : AU_[static_cast<std::size_t>(i)];
+    for (int j = 0; j < k; j++) {
+      E_inv_(i, j) = Dot(z, AU_[static_cast<std::size_t>(j)]);
+    }
+  }
+  E_inv_.Invert();
+  projection_valid_ = true;
+}
+
+void RecyclingKrylovSolver::ProjectionCoefficients(const mfem::Vector& v, mfem::Vector& coefficients) const
+{
+  const int    k = RecycledDimension();
+  mfem::Vector z_dot_v(k);
+  for (int i = 0; i < k; i++) {
+    z_dot_v(i) = Dot(symmetric_ ? U_[static_cast<std::size_t>(i)] : AU_[static_cast<std::size_t>(i)], v);
+  }
+  coefficients.SetSize(k);
+  E_inv_.Mult(z_dot_v, coefficients);
+}
+
+void RecyclingKrylovSolver::ProjectedOperator::Mult(const mfem::Vector& v, mfem::Vector& y) const
+{
+  solver_.oper->Mult(v, y);
+  if (solver_.U_.empty()) {
+    return;
+  }
+  solver_.ProjectionCoefficients(y, solver_.coefficients_);
+  for (int i = 0; i < solver_.RecycledDimension(); i++) {
+    y.Add(-solver_.coefficients_(i), solver_.AU_[static_cast<std::size_t>(i)]);
+  }
+}
+
+void RecyclingKrylovSolver::Mult(const mfem::Vector& b, mfem::Vector& x) const
+{
+  SLIC_ERROR_ROOT_IF(!oper, "The operator must be set before solving");
+
+  if (!iterative_mode) {
+    x = 0.0;
+  }
+
+  r_.SetSize(height);
+  oper->Mult(x, r_);
+  subtract(b, r_, r_);
+  const double initial_norm = Norm(r_);
+
+  // The best correction in the recycled subspace, after which the residual is orthogonal to it
+  d_.SetSize(width);
+  d_ = 0.0;
+  if (!U_.empty()) {
+    UpdateProjection();
+    ProjectionCoefficients(r_, coefficients_);
+    for (int i = 0; i < RecycledDimension(); i++) {
+      d_.Add(coefficients_(i), U_[static_cast<std::size_t>(i)]);
+      r_.Add(-coefficients_(i), AU_[static_cast<std::size_t>(i)]);
+    }
+  }
+
+  // The wrapped solver's tolerance is relative to the projected residual, so scale it to keep
+  // the requested reduction of the original one
+  const double projected_norm = Norm(r_);
+  solver_->SetRelTol(projected_norm > 0.0 ? std::min(1.0, rel_tol * initial_norm / projected_norm) : rel_tol);
+  solver_->SetAbsTol(abs_tol);
+  solver_->SetMaxIter(max_iter);
+  solver_->SetPrintLevel(print_level);
+
+  y_.SetSize(width);
+  y_ = 0.0;
+  if (projected_norm > 0.0) {
+    solver_->Mult(r_, y_);
+  }
+  d_ += y_;
+
+  // Remove the component of y along the recycled subspace that the projection accounted for
+  if (!U_.empty()) {
+    mfem::Vector w_dot_y(RecycledDimension());
+    if (symmetric_) {
+      // (A U)^T y = U^T A y for a symmetric operator
+      for (int i = 0; i < RecycledDimension(); i++) {
+        w_dot_y(i) = Dot(AU_[static_cast<std::size_t>(i)], y_);
+      }
+    } else {
+      Ay_.SetSize(height);
+      oper->Mult(y_, Ay_);
+      for (int i = 0; i < RecycledDimension(); i++) {
+        w_dot_y(i) = Dot(AU_[static_cast<std::size_t>(i)], Ay_);
+      }
+    }
+    E_inv_.Mult(w_dot_y, coefficients_);
+    for (int i = 0; i < RecycledDimension(); i++) {
+      d_.Add(-coefficients_(i), U_[static_cast<std::size_t>(i)]);
+    }
+  }
+
+  x += d_;
+  Recycle(d_);
+
+  final_iter = solver_->GetNumIterations();
+  final_norm = solver_->GetFinalNorm();
+  converged  = solver_->GetConverged();
+}
+
+void RecyclingKrylovSolver::Recycle(const mfem::Vector& d) const
+{
+  const double correction_norm = Norm(d);
+  if (correction_norm == 0.0) {
+    return;
+  }
+
+  // Modified Gram-Schmidt against the (orthonormal) recycled basis
+  mfem::Vector u(d);
+  for (const auto& v : U_) {
+    u.Add(-Dot(v, u), v);
+  }
+
+  // Corrections already (nearly) in the recycled subspace add nothing
+  constexpr double dependence_tolerance = 1.0e-8;
+  const double     norm                 = Norm(u);
+  if (norm <= dependence_tolerance * correction_norm) {
+    return;
+  }
+  u /= norm;
+
+  U_.push_back(std::move(u));
+  if (RecycledDimension() > recycle_dim_) {
+    U_.pop_front();
+  }
+  projection_valid_ = false;
+}
+
+}  // namespace serac::mfem_ext
@@ -0,0 +1,182 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file recycling_solver.hpp
+ *
+ * @brief A Krylov solver that recycles a subspace from previous solves of a slowly varying sequence of systems
+ */
+
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "mfem.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief Augments a Krylov solver with a subspace U recycled from the previous solves in a sequence
+ *
+ * Each solve first computes the best correction in span(U), and then runs the wrapped Krylov method on the
+ * operator projected onto the complement of that space, so the wrapped method never has to resolve the
+ * components of the solution that U already captures (GCRO-style augmentation). Two projections are used:
+ *  - for symmetric methods (CG, MINRES), the A-orthogonal (Galerkin) projection of deflated CG,
+ *    P = I - A U (U^T A U)^{-1} U^T, which keeps the projected operator symmetric
+ *  - otherwise (GMRES), the minimal residual projection P = I - C (C^T C)^{-1} C^T with C = A U
+ *
+ * The recycled subspace is spanned by the corrections computed in the last few solves, rather than by the
+ * harmonic Ritz vectors of GCRO-DR, so neither the Krylov basis nor a dense eigensolver is needed. In a
+ * sequence of nearly identical systems (e.g. the time steps of a transient simulation, or the iterations
+ * of a Newton solve) those corrections are dominated by the same slowly converging modes.
+ */
+class RecyclingKrylovSolver : public mfem::IterativeSolver {
+public:
+  /**
+   * @brief Constructs the solver
+   * @param[in] comm The MPI communicator object
+   * @param[in] solver The Krylov solver to augment
+   * @param[in] recycle_dim The maximum dimension of the recycled subspace
+   * @param[in] symmetric Whether the operators and the wrapped solver are symmetric, which selects the projection
+   */
+  RecyclingKrylovSolver(MPI_Comm comm, std::unique_ptr<mfem::IterativeSolver> solver, int recycle_dim,
+                        bool symmetric);
+
+  /**
+   * @brief Sets the operator of the next solves, which is also passed to the preconditioner
+   * @param[in] op The linear operator
+   * @note Implements mfem::Operator::SetOperator
+   */
+  void SetOperator(const mfem::Operator& op) override;
+
+  /**
+   * @brief Sets the preconditioner applied by the wrapped Krylov solver
+   * @param[in] pr The preconditioner
+   */
+  void SetPreconditioner(mfem::Solver& pr) override;
+
+  /**
+   * @brief Solves A x = b, and adds the computed correction to the recycled subspace
+   * @param[in] b The right hand side
+   * @param[inout] x The solution, which is also the initial guess in iterative mode
+   * @note Implements mfem::Operator::Mult
+   */
+  void Mult(const mfem::Vector& b, mfem::Vector& x) const override;
+
+  /**
+   * @brief The current dimension of the recycled subspace
+   */
+  int RecycledDimension() const { return static_cast<int>(U_.size()); }
+
+  /**
+   * @brief Discards the recycled subspace, e.g. when the sequence of systems is interrupted
+   */
+  void ClearRecycledSpace();
+
+private:
+  /**
+   * @brief The operator P A that the wrapped Krylov solver is applied to
+   */
+  class ProjectedOperator : public mfem::Operator {
+  public:
+    /**
+     * @brief Constructs the operator
+     * @param[in] solver The solver holding the operator A and the recycled subspace
+     */
+    explicit ProjectedOperator(const RecyclingKrylovSolver& solver) : solver_(solver) {}
+
+    /**
+     * @brief Applies P A
+     * @param[in] v The input vector
+     * @param[out] y The projected product
+     */
+    void Mult(const mfem::Vector& v, mfem::Vector& y) const override;
+
+    /// @brief Updates the size after the operator A changed
+    void Resize(int h, int w)
+    {
+      height = h;
+      width  = w;
+    }
+
+  private:
+    /// @brief The solver holding the operator A and the recycled subspace
+    const RecyclingKrylovSolver& solver_;
+  };
+
+  /**
+   * @brief Forwards the wrapped Krylov solver's preconditioner applications, but not its operator updates,
+   * since the preconditioner is built from A rather than from P A
+   */
+  class PreconditionerProxy : public mfem::Solver {
+  public:
+    /// @brief Ignores the projected operator
+    void SetOperator(const mfem::Operator&) override {}
+
+    /**
+     * @brief Applies the preconditioner
+     * @param[in] r The input vector
+     * @param[out] z The preconditioned vector
+     */
+    void Mult(const mfem::Vector& r, mfem::Vector& z) const override { prec->Mult(r, z); }
+
+    /// @brief The preconditioner
+    mfem::Solver* prec = nullptr;
+  };
+
+  /**
+   * @brief Recomputes A U and the small projected matrix after the operator or the recycled subspace changed
+   */
+  void UpdateProjection() const;
+
+  /**
+   * @brief Computes the coefficients E^{-1} Z^T v, with Z = U for the Galerkin projection and Z = A U otherwise
+   * @param[in] v The input vector
+   * @param[out] coefficients The coefficients with respect to the recycled basis
+   */
+  void ProjectionCoefficients(const mfem::Vector& v, mfem::Vector& coefficients) const;
+
+  /**
+   * @brief Orthogonalizes a correction against the recycled subspace and adds it, discarding the oldest vector
+   * if the subspace is full
+   * @param[in] d The correction computed by a solve
+   */
+  void Recycle(const mfem::Vector& d) const;
+
+  /// @brief The wrapped Krylov solver
+  std::unique_ptr<mfem::IterativeSolver> solver_;
+
+  /// @brief The maximum dimension of the recycled subspace
+  int recycle_dim_;
+
+  /// @brief Whether the Galerkin (symmetric) projection is used
+  bool symmetric_;
+
+  /// @brief The operator applied by the wrapped Krylov solver
+  ProjectedOperator projected_;
+
+  /// @brief The preconditioner passed to the wrapped Krylov solver
+  PreconditionerProxy prec_proxy_;
+
+  /// @brief The (orthonormal) basis of the recycled subspace, oldest first
+  mutable std::deque<mfem::Vector> U_;
+
+  /// @brief The products A U for the current operator
+  mutable std::vector<mfem::Vector> AU_;
+
+  /// @brief The inverse of the projected matrix E = Z^T A U
+  mutable mfem::DenseMatrix E_inv_;
+
+  /// @brief Whether AU_ and E_inv_ are consistent with the current operator and subspace
+  mutable bool projection_valid_ = false;
+
+  /// @brief Scratch vectors
+  mutable mfem::Vector r_, d_, y_, Ay_, coefficients_;
+};
+
+}  // namespace serac::mfem_ext
@@ -0,0 +1,75 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/solution_predictor.hpp"
+
+#include <vector>
+
+namespace serac::mfem_ext {
+
+void SolutionPredictor::SetType(PredictorType type)
+{
+  type_ = type;
+  switch (type_) {
+    case PredictorType::Linear:
+      num_points_ = 2;
+      break;
+    case PredictorType::Quadratic:
+      num_points_ = 3;
+      break;
+    default:
+      num_points_ = 0;
+  }
+  history_.clear();
+}
+
+void SolutionPredictor::Record(double time, const mfem::Vector& x)
+{
+  if (num_points_ == 0) {
+    return;
+  }
+
+  // a repeated solve at the same time replaces the previous solution
+  if (!history_.empty() && history_.back().first == time) {
+    history_.back().second = x;
+    return;
+  }
+
+  history_.emplace_back(time, x);
+  if (history_.size() > num_points_) {
+    history_.pop_front();
+  }
+}
+
+void SolutionPredictor::Extrapolate(double time, mfem::Vector& x) const
+{
+  if (history_.size() < 2) {
+    return;
+  }
+
+  // Lagrange interpolation weights of the recorded times, evaluated at the new time
+  const std::size_t   n = history_.size();
+  std::vector<double> weights(n, 1.0);
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t j = 0; j < n; j++) {
+      if (i != j) {
+        const double dt = history_[i].first - history_[j].first;
+        if (dt == 0.0) {
+          return;
+        }
+        weights[i] *= (time - history_[j].first) / dt;
+      }
+    }
+  }
+
+  x.SetSize(history_.back().second.Size());
+  x = 0.0;
+  for (std::size_t i = 0; i < n; i++) {
+    x.Add(weights[i], history_[i].second);
+  }
+}
+
+}  // namespace serac::mfem_ext
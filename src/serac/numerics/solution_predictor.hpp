@@ -0,0 +1,83 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file solution_predictor.hpp
+ *
+ * @brief Initial guesses for the nonlinear solves of a sequence of time (or load) steps
+ */
+
+#pragma once
+
+#include <deque>
+#include <utility>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief Predicts the solution of the next step from the solutions of the previous steps
+ *
+ * The extrapolating predictors fit a polynomial in time through the recorded solutions, so variable step sizes
+ * are accounted for. The tangent predictor starts from the previous solution and takes one Newton step with the
+ * Jacobian of the previous solve, see EquationSolver::PredictWithLastJacobian. Until enough steps have been
+ * recorded, the predictors fall back to lower order ones.
+ */
+class SolutionPredictor {
+public:
+  /**
+   * @brief Constructs the predictor
+   * @param[in] type The predictor type
+   */
+  explicit SolutionPredictor(PredictorType type = PredictorType::Previous) { SetType(type); }
+
+  /**
+   * @brief Sets the predictor type, discarding the recorded solutions
+   * @param[in] type The predictor type
+   */
+  void SetType(PredictorType type);
+
+  /**
+   * @brief The predictor type
+   */
+  PredictorType Type() const { return type_; }
+
+  /**
+   * @brief Records the converged solution of a step
+   * @param[in] time The time of the step
+   * @param[in] x The solution
+   */
+  void Record(double time, const mfem::Vector& x);
+
+  /**
+   * @brief Overwrites x with the prediction from the recorded solutions at the given time
+   * @param[in] time The time of the next step
+   * @param[inout] x The initial guess, which is left unchanged if no extrapolation is possible
+   * @note The tangent step is taken separately, since it must see the boundary conditions of the new step
+   * @see EquationSolver::PredictWithLastJacobian
+   */
+  void Extrapolate(double time, mfem::Vector& x) const;
+
+  /**
+   * @brief Discards the recorded solutions, e.g. after the state was reset
+   */
+  void Reset() { history_.clear(); }
+
+private:
+  /// @brief The predictor type
+  PredictorType type_;
+
+  /// @brief The number of solutions the extrapolating polynomial is fit through
+  std::size_t num_points_;
+
+  /// @brief The recorded times and solutions, oldest first
+  std::deque<std::pair<double, mfem::Vector>> history_;
+};
+
+}  // namespace serac::mfem_ext
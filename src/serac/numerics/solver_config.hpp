@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
 #include <variant>
 
 #include "mfem.hpp"
@@ -97,15 +99,84 @@ enum class DirichletEnforcementMethod
   FullControl
 };
 
+/**
+ * @brief The initial guess for the nonlinear solve of each time step
+ */
+enum class PredictorType
+{
+  Previous,  /**< The solution of the previous step */
+  Linear,    /**< Linear extrapolation in time from the solutions of the previous two steps */
+  Quadratic, /**< Quadratic extrapolation in time from the solutions of the previous three steps */
+  Tangent    /**< One (Euler-Newton) step from the previous solution with the most recently evaluated Jacobian */
+};
+
+/**
+ * @brief Parameters of error-controlled adaptive time stepping
+ *
+ * The local error estimate e of each step is measured in the weighted RMS norm
+ * sqrt(mean((e_i / (abs_tol + rel_tol * |x_i|))^2)), and the step is accepted when that norm is at most one.
+ * The step size is then chosen by a PI controller, and a rejected step is repeated from the start of the step
+ * with a smaller step size.
+ */
+struct AdaptiveTimestepOptions {
+  /**
+   * @brief The relative tolerance of the local error estimate
+   */
+  double rel_tol = 1.0e-3;
+
+  /**
+   * @brief The absolute tolerance of the local error estimate
+   */
+  double abs_tol = 1.0e-6;
+
+  /**
+   * @brief The size of the first step attempted, or 0 to attempt the requested step size
+   */
+  double initial_dt = 0.0;
+
+  /**
+   * @brief The smallest step size before the time integration is aborted
+   */
+  double min_dt = 1.0e-12;
+
+  /**
+   * @brief The safety factor applied to the step size proposed by the controller
+   */
+  double safety_factor = 0.9;
+
+  /**
+   * @brief The largest factor the step size may grow by after an accepted step
+   */
+  double max_growth = 5.0;
+
+  /**
+   * @brief The smallest factor the step size may shrink by after a rejected step
+   */
+  double max_shrink = 0.1;
+
+  /**
+   * @brief The factor the step size is cut back by when the nonlinear solve of a step fails
+   */
+  double nonlinear_failure_cutback = 0.25;
+
+  /**
+   * @brief The maximum number of consecutive rejections of a step before the time integration is aborted
+   */
+  int max_rejections = 10;
+};
+
 /**
  * @brief Linear solution method
  */
 enum class LinearSolver
 {
-  CG,     /**< Conjugate Gradient */
-  GMRES,  /**< Generalized minimal residual method */
-  MINRES, /**< Minimal residual method */
-  SuperLU /**< SuperLU Direct Solver */
+  CG,             /**< Conjugate Gradient */
+  GMRES,          /**< Generalized minimal residual method */
+  MINRES,         /**< Minimal residual method */
+  SuperLU,        /**< SuperLU Direct Solver */
+  PipelinedCG,    /**< Conjugate Gradient with one reduction per iteration, overlapped with the operator */
+  PipelinedGMRES, /**< GMRES with one reduction per iteration, overlapped with the operator */
+  SStepCG         /**< Conjugate Gradient with one reduction per block of s iterations */
 };
 
 /**
@@ -113,9 +184,32 @@ enum class LinearSolver
  */
 enum class NonlinearSolver
 {
-  MFEMNewton,               /**< Newton-Raphson */
-  KINFullStep,              /**< KINFullStep */
-  KINBacktrackingLineSearch /**< KINBacktrackingLineSearch */
+  MFEMNewton,                /**< Newton-Raphson */
+  KINFullStep,               /**< KINFullStep */
+  KINBacktrackingLineSearch, /**< KINBacktrackingLineSearch */
+  LBFGS,                     /**< Limited-memory BFGS, preconditioned by an occasionally refreshed Jacobian */
+  Broyden,                   /**< Broyden's method, preconditioned by an occasionally refreshed Jacobian */
+  Anderson                   /**< Anderson-accelerated fixed point iteration with an occasionally refreshed Jacobian */
+};
+
+/**
+ * @brief How the relative tolerance of the linear solves inside a Newton iteration is chosen
+ */
+enum class NewtonForcingTerm
+{
+  Fixed,            /**< The linear solver's own relative tolerance */
+  EisenstatWalker1, /**< Eisenstat-Walker choice 1, based on the linear model's agreement with the residual */
+  EisenstatWalker2  /**< Eisenstat-Walker choice 2, based on the residual norm reduction */
+};
+
+/**
+ * @brief Line search method used to globalize the Newton iteration
+ */
+enum class NewtonLineSearch
+{
+  None,         /**< Full Newton steps */
+  Backtracking, /**< Backtracking until the residual norm satisfies the Armijo condition */
+  CriticalPoint /**< Secant search for a stationary point of the energy, for residuals that are energy gradients */
 };
 
 /**
@@ -188,10 +282,48 @@ struct BlockILUPrec {
   int block_size;
 };
 
+/**
+ * @brief The local subdomains ("patches") used by an element-based preconditioner
+ */
+enum class SchwarzOverlap
+{
+  None,       /**< Non-overlapping element blocks, i.e., element-block Jacobi */
+  Element,    /**< One overlapping patch per element, containing all of that element's DOFs */
+  VertexPatch /**< One overlapping patch per vertex, containing the DOFs of every element touching that vertex */
+};
+
+/**
+ * @brief Stores the information required to configure a preconditioner built from the element
+ * gradients that serac::Functional computes, without global matrix assembly
+ */
+struct ElementSchwarzPrec {
+  /**
+   * @brief The type of local subdomains to use
+   */
+  SchwarzOverlap overlap = SchwarzOverlap::None;
+
+  /**
+   * @brief The par finite element space that the element matrices are defined on
+   * @note This is set by the physics module that owns the underlying serac::Functional
+   */
+  mfem::ParFiniteElementSpace* pfes = nullptr;
+
+  /**
+   * @brief A callback that returns the processor-local sparse matrix summed from the current element gradients
+   * @note This is set by the physics module that owns the underlying serac::Functional
+   */
+  std::function<const mfem::SparseMatrix&()> local_matrix;
+
+  /**
+   * @brief The (optional) list of essential true DOFs, which are treated as eliminated
+   */
+  const mfem::Array<int>* essential_tdofs = nullptr;
+};
+
 /**
  * @brief Preconditioning method
  */
-using Preconditioner = std::variant<HypreSmootherPrec, HypreBoomerAMGPrec, AMGXPrec, BlockILUPrec>;
+using Preconditioner = std::variant<HypreSmootherPrec, HypreBoomerAMGPrec, AMGXPrec, BlockILUPrec, ElementSchwarzPrec>;
 
 /**
  * @brief Abstract multiphysics coupling scheme
@@ -203,6 +335,39 @@ enum class CouplingScheme
   FullyCoupled   /**< FullyCoupled */
 };
 
+/**
+ * @brief Controls when a preconditioner is rebuilt from a new operator (e.g. a new Newton Jacobian),
+ * as opposed to reusing the one built from a previous operator
+ *
+ * The preconditioner is rebuilt when any of the enabled criteria is met. The default values
+ * rebuild the preconditioner every time the operator changes.
+ */
+struct PreconditionerReuseOptions {
+  /**
+   * @brief Rebuild after this many operator updates. A value of 0 disables this criterion.
+   */
+  int rebuild_interval = 1;
+
+  /**
+   * @brief Rebuild when the previous linear solve needed more than this many iterations.
+   * A value of 0 disables this criterion.
+   */
+  int max_linear_iterations = 0;
+
+  /**
+   * @brief Rebuild on the first operator update of each new solve (e.g. time step or load step)
+   */
+  bool rebuild_on_new_step = false;
+
+  /**
+   * @brief When reusing an algebraic multigrid preconditioner, keep its coarse hierarchy but apply
+   * the fine-level smoother and residual with the new operator
+   * @note The fine-level smoother keeps the scaling computed from the operator of the last rebuild,
+   * so a rebuild criterion such as max_linear_iterations should also be enabled
+   */
+  bool freeze_amg_hierarchy = false;
+};
+
 /**
  * @brief Parameters for an iterative linear solution scheme
  */
@@ -236,6 +401,34 @@ struct IterativeSolverOptions {
    * @brief Preconditioner selection
    */
   std::optional<Preconditioner> prec;
+
+  /**
+   * @brief The policy for reusing the preconditioner across operator updates
+   */
+  PreconditionerReuseOptions prec_reuse = {};
+
+  /**
+   * @brief The maximum dimension of the subspace recycled from previous solves, 0 to disable recycling
+   * @see mfem_ext::RecyclingKrylovSolver
+   */
+  int recycle_dim = 0;
+
+  /**
+   * @brief The number of Krylov vectors generated per global reduction by LinearSolver::SStepCG
+   */
+  int s_step = 4;
+
+  /**
+   * @brief Compute the corrections of a double precision iterative refinement with a single precision copy
+   * of the operator, which is intended for well-scaled problems
+   * @see mfem_ext::MixedPrecisionRefinementSolver
+   */
+  bool mixed_precision = false;
+
+  /**
+   * @brief The relative tolerance of the single precision correction solves of a mixed precision solve
+   */
+  double inner_rel_tol = 1.0e-4;
 };
 
 /**
@@ -258,6 +451,12 @@ struct DirectSolverOptions {
    * @brief Debugging print level
    */
   int print_level;
+
+  /**
+   * @brief Whether to reuse the permutations and symbolic factorization of the previous operator
+   * when its sparsity pattern is unchanged, so that only the numeric factorization is redone
+   */
+  bool reuse_symbolic_factorization = true;
 };
 
 /**
@@ -293,6 +492,66 @@ struct NonlinearSolverOptions {
    * @brief Nonlinear solver selection
    */
   NonlinearSolver nonlin_solver = NonlinearSolver::MFEMNewton;
+
+  /**
+   * @brief The maximum number of iterations a Jacobian (and its preconditioner or factorization) is reused for.
+   * A value of 1 is the standard Newton method, and a value of 0 only refreshes the Jacobian when the
+   * convergence rate degrades. When unset, NonlinearSolver::MFEMNewton uses 1 and the quasi-Newton solvers use 0.
+   */
+  std::optional<int> max_jacobian_age;
+
+  /**
+   * @brief Refresh the Jacobian when an iteration reduces the residual norm by less than this factor,
+   * i.e. when ||r_{k+1}|| > jacobian_refresh_rate * ||r_k||
+   */
+  double jacobian_refresh_rate = 0.5;
+
+  /**
+   * @brief Whether the last Jacobian of a solve may be reused by the next solve (e.g. the next time step)
+   */
+  bool reuse_jacobian_across_solves = false;
+
+  /**
+   * @brief How the linear solver tolerance is chosen in each Newton iteration
+   * @note The adaptive choices require an iterative linear solver and NonlinearSolver::MFEMNewton
+   */
+  NewtonForcingTerm forcing_term = NewtonForcingTerm::Fixed;
+
+  /**
+   * @brief The linear solver relative tolerance of the first Newton iteration for adaptive forcing terms
+   */
+  double initial_forcing_term = 0.5;
+
+  /**
+   * @brief The upper bound on the linear solver relative tolerance for adaptive forcing terms
+   */
+  double max_forcing_term = 0.9;
+
+  /**
+   * @brief The line search used by NonlinearSolver::MFEMNewton
+   */
+  NewtonLineSearch line_search = NewtonLineSearch::None;
+
+  /**
+   * @brief The maximum number of residual evaluations in a single line search
+   */
+  int max_line_search_iterations = 10;
+
+  /**
+   * @brief The sufficient decrease constant of the backtracking line search, which accepts a step length alpha when
+   * ||r(x - alpha c)|| <= (1 - armijo_constant * alpha) ||r(x)||
+   */
+  double armijo_constant = 1.0e-4;
+
+  /**
+   * @brief The factor the step length is reduced by in each backtracking line search iteration
+   */
+  double backtracking_factor = 0.5;
+
+  /**
+   * @brief The number of previous iterates used by the LBFGS, Broyden and Anderson nonlinear solvers
+   */
+  int quasi_newton_memory = 5;
 };
 
 }  // namespace serac
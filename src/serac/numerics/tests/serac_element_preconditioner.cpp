@@ -0,0 +1,107 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <gtest/gtest.h>
+
+#include "serac/numerics/element_preconditioner.hpp"
+
+#include "mfem.hpp"
+
+namespace serac {
+
+class ElementPreconditioner : public ::testing::TestWithParam<SchwarzOverlap> {
+};
+
+TEST_P(ElementPreconditioner, AcceleratesCG)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  auto serial_mesh = mfem::Mesh::MakeCartesian2D(8, 8, mfem::Element::QUADRILATERAL, true);
+  mfem::ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+
+  mfem::H1_FECollection       fec(2, mesh.Dimension());
+  mfem::ParFiniteElementSpace fes(&mesh, &fec);
+
+  mfem::Array<int> ess_bdr(mesh.bdr_attributes.Max());
+  ess_bdr = 1;
+  mfem::Array<int> ess_tdofs;
+  fes.GetEssentialTrueDofs(ess_bdr, ess_tdofs);
+
+  mfem::ConstantCoefficient one(1.0);
+  mfem::ParBilinearForm     a(&fes);
+  a.AddDomainIntegrator(new mfem::DiffusionIntegrator(one));
+  a.AddDomainIntegrator(new mfem::MassIntegrator(one));
+  a.Assemble();
+  a.Finalize();
+
+  // the processor-local matrix plays the role of the summed element gradients
+  const mfem::SparseMatrix&             local = a.SpMat();
+  std::unique_ptr<mfem::HypreParMatrix> A(a.ParallelAssemble());
+  std::unique_ptr<mfem::HypreParMatrix> A_e(A->EliminateRowsCols(ess_tdofs));
+
+  mfem::Vector b(fes.GetTrueVSize());
+  b.Randomize(1);
+  b.SetSubVector(ess_tdofs, 0.0);
+
+  auto solve = [&](mfem::Solver* prec) {
+    mfem::CGSolver cg(MPI_COMM_WORLD);
+    cg.SetRelTol(1.0e-10);
+    cg.SetMaxIter(500);
+    if (prec) {
+      cg.SetPreconditioner(*prec);
+    }
+    cg.SetOperator(*A);
+    mfem::Vector x(b.Size());
+    x = 0.0;
+    cg.Mult(b, x);
+    EXPECT_TRUE(cg.GetConverged());
+
+    mfem::Vector r(b.Size());
+    A->Mult(x, r);
+    r -= b;
+    EXPECT_LT(r.Norml2(), 1.0e-8 * b.Norml2());
+    return cg.GetNumIterations();
+  };
+
+  mfem_ext::ElementSchwarzPreconditioner prec(
+      fes, [&]() -> const mfem::SparseMatrix& { return local; }, GetParam(), &ess_tdofs);
+
+  int unpreconditioned_iterations = solve(nullptr);
+  int preconditioned_iterations   = solve(&prec);
+
+  EXPECT_LT(preconditioned_iterations, unpreconditioned_iterations);
+  EXPECT_GT(prec.NumPatches(), 0);
+
+  // the local inverses are refactored whenever the operator changes
+  EXPECT_EQ(prec.NumFactorizations(), 1);
+  prec.SetOperator(*A);
+  EXPECT_EQ(prec.NumFactorizations(), 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(ElementPreconditionerTests, ElementPreconditioner,
+                         testing::Values(SchwarzOverlap::None, SchwarzOverlap::Element, SchwarzOverlap::VertexPatch));
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "serac/numerics/krylov_solvers.hpp"
+
+#include "mfem.hpp"
+
+namespace serac {
+
+constexpr int size = 60;
+
+/// a shifted 1D Laplacian with a varying diagonal, optionally made nonsymmetric by an upwind-like term
+mfem::SparseMatrix test_matrix(double skew)
+{
+  mfem::SparseMatrix A(size, size);
+  for (int i = 0; i < size; i++) {
+    A.Add(i, i, 2.0 + 0.01 * i);
+    if (i > 0) A.Add(i, i - 1, -1.0);
+    if (i < size - 1) A.Add(i, i + 1, -1.0 + skew);
+  }
+  A.Finalize();
+  return A;
+}
+
+/// solves A x = b with a Jacobi preconditioner, checks the true residual, and returns the iteration count
+int solve(mfem::IterativeSolver& solver, const mfem::SparseMatrix& A)
+{
+  mfem::DSmoother jacobi(A);
+  solver.SetRelTol(1.0e-10);
+  solver.SetAbsTol(0.0);
+  solver.SetMaxIter(500);
+  solver.SetPrintLevel(-1);
+  solver.SetPreconditioner(jacobi);
+  solver.SetOperator(A);
+
+  mfem::Vector b(size), x(size), r(size);
+  for (int i = 0; i < size; i++) {
+    b(i) = 1.0 + std::sin(i);
+  }
+  x = 0.0;
+  solver.Mult(b, x);
+  EXPECT_TRUE(solver.GetConverged());
+
+  A.Mult(x, r);
+  r -= b;
+  EXPECT_LT(r.Norml2(), 1.0e-8 * b.Norml2());
+  return solver.GetNumIterations();
+}
+
+TEST(krylov_solvers, pipelined_cg_matches_cg)
+{
+  auto A = test_matrix(0.0);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  const int      cg_iterations = solve(cg, A);
+
+  mfem_ext::PipelinedCGSolver pipelined_cg(MPI_COMM_WORLD);
+  EXPECT_NEAR(solve(pipelined_cg, A), cg_iterations, 2);
+}
+
+TEST(krylov_solvers, s_step_cg)
+{
+  auto A = test_matrix(0.0);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  const int      cg_iterations = solve(cg, A);
+
+  // each block reproduces s iterations of CG, so at most one extra block is needed
+  for (int s : {1, 2, 4}) {
+    mfem_ext::SStepCGSolver s_step_cg(MPI_COMM_WORLD, s);
+    EXPECT_LE(solve(s_step_cg, A), cg_iterations + 2 * s);
+  }
+}
+
+TEST(krylov_solvers, pipelined_gmres)
+{
+  auto A = test_matrix(0.3);
+
+  mfem_ext::PipelinedGMRESSolver pipelined_gmres(MPI_COMM_WORLD);
+  solve(pipelined_gmres, A);
+
+  // restarts recompute the true residual
+  mfem_ext::PipelinedGMRESSolver restarted_gmres(MPI_COMM_WORLD, 10);
+  solve(restarted_gmres, A);
+}
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
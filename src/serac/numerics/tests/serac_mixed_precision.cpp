@@ -0,0 +1,115 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cmath>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "serac/numerics/mixed_precision.hpp"
+
+#include "mfem.hpp"
+
+namespace serac {
+
+constexpr int size = 60;
+
+/// a shifted 1D Laplacian with a varying diagonal, whose entries are not representable in single precision
+class TestMatrix {
+public:
+  TestMatrix() : local_(size, size)
+  {
+    for (int i = 0; i < size; i++) {
+      local_.Add(i, i, 2.0 + 0.01 * i + 1.0e-9);
+      if (i > 0) local_.Add(i, i - 1, -1.0 - 1.0e-9);
+      if (i < size - 1) local_.Add(i, i + 1, -1.0 - 1.0e-9);
+    }
+    local_.Finalize();
+    matrix_ = std::make_unique<mfem::HypreParMatrix>(MPI_COMM_WORLD, HYPRE_BigInt(size), row_starts_, &local_);
+  }
+
+  const mfem::HypreParMatrix& operator*() const { return *matrix_; }
+
+private:
+  HYPRE_BigInt                          row_starts_[2] = {0, size};
+  mfem::SparseMatrix                    local_;
+  std::unique_ptr<mfem::HypreParMatrix> matrix_;
+};
+
+mfem::Vector rhs()
+{
+  mfem::Vector b(size);
+  for (int i = 0; i < size; i++) {
+    b(i) = 1.0 + std::sin(i);
+  }
+  return b;
+}
+
+TEST(mixed_precision, single_precision_matrix)
+{
+  TestMatrix A;
+  auto       x = rhs();
+
+  mfem::Vector y(size), y_single(size);
+  (*A).Mult(x, y);
+  mfem_ext::SinglePrecisionParMatrix A_single(*A);
+  A_single.Mult(x, y_single);
+
+  y_single -= y;
+  EXPECT_GT(y_single.Norml2(), 0.0);
+  EXPECT_LT(y_single.Norml2(), 1.0e-6 * y.Norml2());
+}
+
+TEST(mixed_precision, refinement_reaches_double_precision)
+{
+  TestMatrix A;
+  auto       b = rhs();
+
+  mfem::HypreSmoother jacobi;
+  jacobi.SetType(mfem::HypreSmoother::Jacobi);
+
+  mfem_ext::MixedPrecisionRefinementSolver solver(MPI_COMM_WORLD, std::make_unique<mfem::CGSolver>(MPI_COMM_WORLD),
+                                                  1.0e-4);
+  solver.SetRelTol(1.0e-13);
+  solver.SetAbsTol(0.0);
+  solver.SetMaxIter(500);
+  solver.SetPrintLevel(-1);
+  solver.SetPreconditioner(jacobi);
+  solver.SetOperator(*A);
+
+  mfem::Vector x(size), r(size);
+  x = 0.0;
+  solver.Mult(b, x);
+  EXPECT_TRUE(solver.GetConverged());
+
+  // the single precision operator alone could not reduce the residual this far
+  EXPECT_GT(solver.NumRefinements(), 1);
+  (*A).Mult(x, r);
+  r -= b;
+  EXPECT_LT(r.Norml2(), 1.0e-12 * b.Norml2());
+}
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -0,0 +1,385 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "mfem.hpp"
+
+#include "serac/numerics/equation_solver.hpp"
+#include "serac/numerics/solution_predictor.hpp"
+#include "serac/numerics/stdfunction_operator.hpp"
+
+using namespace serac;
+using namespace serac::mfem_ext;
+
+constexpr int size = 10;
+
+const IterativeSolverOptions linear_options{.rel_tol     = 1.0e-14,
+                                            .abs_tol     = 1.0e-14,
+                                            .print_level = -1,
+                                            .max_iter    = 100,
+                                            .lin_solver  = LinearSolver::CG,
+                                            .prec        = {}};
+
+/**
+ * @brief Counts the applications of a matrix, i.e. the Krylov iterations of the linear solves with it
+ */
+class CountingOperator : public mfem::Operator {
+public:
+  CountingOperator(const mfem::SparseMatrix& A, int& count)
+      : mfem::Operator(A.Height(), A.Width()), A_(A), count_(count)
+  {
+  }
+
+  void Mult(const mfem::Vector& x, mfem::Vector& y) const override
+  {
+    count_++;
+    A_.Mult(x, y);
+  }
+
+  void MultTranspose(const mfem::Vector& x, mfem::Vector& y) const override
+  {
+    count_++;
+    A_.MultTranspose(x, y);
+  }
+
+private:
+  const mfem::SparseMatrix& A_;
+  int&                      count_;
+};
+
+/**
+ * @brief A mildly nonlinear system of equations, r(x) := K x + epsilon * x^3 - f = 0,
+ * where K is the 1D Laplacian and the cube is taken elementwise
+ */
+class CubicProblem {
+public:
+  CubicProblem(double epsilon = 0.1)
+      : epsilon_(epsilon),
+        K_(laplacian()),
+        residual_(
+            size,
+            [this](const mfem::Vector& x, mfem::Vector& r) {
+              K_.Mult(x, r);
+              for (int i = 0; i < size; i++) {
+                r[i] += epsilon_ * x[i] * x[i] * x[i];
+              }
+              r -= f_;
+            },
+            [this](const mfem::Vector& x) -> mfem::Operator& {
+              num_jacobian_evaluations++;
+              J_ = std::make_unique<mfem::SparseMatrix>(K_);
+              for (int i = 0; i < size; i++) {
+                J_->Add(i, i, 3.0 * epsilon_ * x[i] * x[i]);
+              }
+              J_op_ = std::make_unique<CountingOperator>(*J_, num_jacobian_applications);
+              return *J_op_;
+            })
+  {
+    f_.SetSize(size);
+    f_ = 1.0;
+  }
+
+  static mfem::SparseMatrix laplacian()
+  {
+    mfem::SparseMatrix K(size, size);
+    for (int i = 0; i < size; i++) {
+      K.Add(i, i, 2.0);
+      if (i > 0) K.Add(i, i - 1, -1.0);
+      if (i < size - 1) K.Add(i, i + 1, -1.0);
+    }
+    K.Finalize();
+    return K;
+  }
+
+  /// solve the problem with the given nonlinear solver options, returning the solution
+  mfem::Vector solve(const NonlinearSolverOptions& nonlinear_options)
+  {
+    EquationSolver solver(MPI_COMM_WORLD, linear_options, nonlinear_options);
+    return solve(solver);
+  }
+
+  /// solve the problem with the given solver, returning the solution
+  mfem::Vector solve(EquationSolver& solver)
+  {
+    solver.SetOperator(residual_);
+
+    mfem::Vector x(size);
+    x = 0.0;
+    solver.Mult(mfem::Vector(), x);
+    EXPECT_TRUE(solver.NonlinearSolver().GetConverged());
+
+    mfem::Vector r(size);
+    residual_.Mult(x, r);
+    EXPECT_LT(r.Norml2(), 1.0e-10);
+    return x;
+  }
+
+  /// scale the load, f = scale * [1, 1, ..., 1]
+  void set_load(double scale) { f_ = scale; }
+
+  StdFunctionOperator& residual() { return residual_; }
+
+  int num_jacobian_evaluations = 0;
+
+  int num_jacobian_applications = 0;
+
+private:
+  double                              epsilon_;
+  mfem::SparseMatrix                  K_;
+  mfem::Vector                        f_;
+  std::unique_ptr<mfem::SparseMatrix> J_;
+  std::unique_ptr<CountingOperator>   J_op_;
+  StdFunctionOperator                 residual_;
+};
+
+NonlinearSolverOptions newton_options()
+{
+  return {.rel_tol = 1.0e-12, .abs_tol = 1.0e-12, .max_iter = 50, .print_level = -1};
+}
+
+TEST(newton_solver, modified_newton_reuses_jacobian)
+{
+  CubicProblem full_newton;
+  auto         reference = full_newton.solve(newton_options());
+
+  auto options             = newton_options();
+  options.max_jacobian_age = 0;
+
+  CubicProblem modified_newton;
+  auto         x = modified_newton.solve(options);
+
+  x -= reference;
+  EXPECT_LT(x.Norml2(), 1.0e-10);
+  EXPECT_LT(modified_newton.num_jacobian_evaluations, full_newton.num_jacobian_evaluations);
+}
+
+TEST(newton_solver, eisenstat_walker_forcing_terms)
+{
+  CubicProblem full_newton;
+  auto         reference = full_newton.solve(newton_options());
+
+  for (auto forcing_term : {NewtonForcingTerm::EisenstatWalker1, NewtonForcingTerm::EisenstatWalker2}) {
+    auto options         = newton_options();
+    options.forcing_term = forcing_term;
+
+    CubicProblem   inexact_newton;
+    EquationSolver solver(MPI_COMM_WORLD, linear_options, options);
+    auto           x = inexact_newton.solve(solver);
+
+    // the loose linear solves far from the solution take fewer Krylov iterations in total
+    EXPECT_LT(inexact_newton.num_jacobian_applications, full_newton.num_jacobian_applications);
+
+    // later solves that share the linear solver, e.g. adjoint solves, still meet the configured tolerance
+    auto&        J = inexact_newton.residual().GetGradient(x);
+    mfem::Vector g(size), lambda(size), r(size);
+    g.Randomize(1);
+    lambda = 0.0;
+    solver.LinearSolver().SetOperator(J);
+    solver.LinearSolver().Mult(g, lambda);
+    J.MultTranspose(lambda, r);
+    r -= g;
+    EXPECT_LT(r.Norml2(), 1.0e-12 * g.Norml2());
+
+    x -= reference;
+    EXPECT_LT(x.Norml2(), 1.0e-10);
+  }
+}
+
+TEST(newton_solver, quasi_newton_methods)
+{
+  CubicProblem full_newton;
+  auto         reference = full_newton.solve(newton_options());
+
+  for (auto method : {NonlinearSolver::LBFGS, NonlinearSolver::Broyden, NonlinearSolver::Anderson}) {
+    auto options          = newton_options();
+    options.nonlin_solver = method;
+
+    CubicProblem quasi_newton;
+    auto         x = quasi_newton.solve(options);
+
+    x -= reference;
+    EXPECT_LT(x.Norml2(), 1.0e-10);
+    EXPECT_LT(quasi_newton.num_jacobian_evaluations, full_newton.num_jacobian_evaluations);
+
+    // an explicit maximum age of 1 refreshes H_0 every iteration, instead of only on stagnation
+    options.max_jacobian_age = 1;
+
+    CubicProblem refreshed_quasi_newton;
+    x = refreshed_quasi_newton.solve(options);
+
+    x -= reference;
+    EXPECT_LT(x.Norml2(), 1.0e-10);
+    EXPECT_GT(refreshed_quasi_newton.num_jacobian_evaluations, quasi_newton.num_jacobian_evaluations);
+  }
+}
+
+TEST(newton_solver, line_search_globalizes_newton)
+{
+  // Newton's method diverges for atan(x) = 0 when |x0| > ~1.39, but arctangent is the gradient
+  // of the convex energy x atan(x) - log(1 + x^2) / 2, so both line searches converge
+  std::unique_ptr<mfem::SparseMatrix> J;
+  StdFunctionOperator                 residual(
+      size,
+      [](const mfem::Vector& x, mfem::Vector& r) {
+        for (int i = 0; i < size; i++) {
+          r[i] = std::atan(x[i]);
+        }
+      },
+      [&J](const mfem::Vector& x) -> mfem::Operator& {
+        mfem::Vector diagonal(size);
+        for (int i = 0; i < size; i++) {
+          diagonal[i] = 1.0 / (1.0 + x[i] * x[i]);
+        }
+        J = std::make_unique<mfem::SparseMatrix>(diagonal);
+        return *J;
+      });
+
+  for (auto line_search : {NewtonLineSearch::Backtracking, NewtonLineSearch::CriticalPoint}) {
+    auto options        = newton_options();
+    options.line_search = line_search;
+
+    EquationSolver solver(MPI_COMM_WORLD, linear_options, options);
+    solver.SetOperator(residual);
+    solver.NonlinearSolver().iterative_mode = true;
+
+    mfem::Vector x(size);
+    x = 3.0;
+    solver.Mult(mfem::Vector(), x);
+
+    EXPECT_TRUE(solver.NonlinearSolver().GetConverged());
+    EXPECT_LT(x.Normlinf(), 1.0e-10);
+  }
+}
+
+TEST(newton_solver, critical_point_line_search_stays_in_domain)
+{
+  // the same arctangent problem, but with an energy that is only defined for |x| < 5: the full Newton step
+  // from x = 3 lands near -9.5, so the line search has to backtrack into the domain before its secant steps
+  constexpr double bound = 5.0;
+
+  std::unique_ptr<mfem::SparseMatrix> J;
+  StdFunctionOperator                 residual(
+      size,
+      [](const mfem::Vector& x, mfem::Vector& r) {
+        for (int i = 0; i < size; i++) {
+          r[i] = (std::abs(x[i]) < bound) ? std::atan(x[i]) : std::numeric_limits<double>::quiet_NaN();
+        }
+      },
+      [&J](const mfem::Vector& x) -> mfem::Operator& {
+        mfem::Vector diagonal(size);
+        for (int i = 0; i < size; i++) {
+          diagonal[i] = 1.0 / (1.0 + x[i] * x[i]);
+        }
+        J = std::make_unique<mfem::SparseMatrix>(diagonal);
+        return *J;
+      });
+
+  auto options        = newton_options();
+  options.line_search = NewtonLineSearch::CriticalPoint;
+
+  EquationSolver solver(MPI_COMM_WORLD, linear_options, options);
+  solver.SetOperator(residual);
+  solver.NonlinearSolver().iterative_mode = true;
+
+  mfem::Vector x(size);
+  x = 3.0;
+  solver.Mult(mfem::Vector(), x);
+
+  EXPECT_TRUE(solver.NonlinearSolver().GetConverged());
+  EXPECT_LT(x.Normlinf(), 1.0e-10);
+}
+
+/// solves the cubic problem with the load ramped up in (unevenly spaced) steps, returning the total Newton iterations
+int load_stepping_iterations(PredictorType type)
+{
+  auto options    = newton_options();
+  options.rel_tol = 0.0;
+
+  CubicProblem   problem;
+  EquationSolver solver(MPI_COMM_WORLD, linear_options, options);
+  solver.SetOperator(problem.residual());
+
+  SolutionPredictor predictor(type);
+  mfem::Vector      x(size);
+  x = 0.0;
+
+  int total_iterations = 0;
+  for (double t : {0.5, 1.0, 1.5, 2.25, 3.0, 4.0}) {
+    problem.set_load(t);
+
+    predictor.Extrapolate(t, x);
+    if (predictor.Type() == PredictorType::Tangent) {
+      solver.PredictWithLastJacobian(mfem::Vector(), x);
+    }
+
+    solver.Mult(mfem::Vector(), x);
+    EXPECT_TRUE(solver.NonlinearSolver().GetConverged());
+    total_iterations += solver.NonlinearSolver().GetNumIterations();
+
+    predictor.Record(t, x);
+  }
+  return total_iterations;
+}
+
+TEST(newton_solver, predictors_reduce_iterations)
+{
+  const int previous = load_stepping_iterations(PredictorType::Previous);
+  for (auto type : {PredictorType::Linear, PredictorType::Quadratic, PredictorType::Tangent}) {
+    EXPECT_LT(load_stepping_iterations(type), previous);
+  }
+}
+
+TEST(solution_predictor, extrapolation_is_exact_for_polynomials)
+{
+  // x(t) = a + b t + c t^2, recorded at unevenly spaced times
+  auto exact = [](double t) {
+    mfem::Vector x(2);
+    x[0] = 1.0 + 2.0 * t;
+    x[1] = 1.0 - t + 0.5 * t * t;
+    return x;
+  };
+
+  SolutionPredictor quadratic(PredictorType::Quadratic);
+  for (double t : {0.0, 0.5, 1.0, 2.0}) {
+    quadratic.Record(t, exact(t));
+  }
+
+  mfem::Vector x(2);
+  quadratic.Extrapolate(3.0, x);
+  x -= exact(3.0);
+  EXPECT_LT(x.Norml2(), 1.0e-12);
+
+  // linear extrapolation is only exact for the linear component
+  SolutionPredictor linear(PredictorType::Linear);
+  linear.Record(1.0, exact(1.0));
+  linear.Record(2.0, exact(2.0));
+  linear.Extrapolate(3.0, x);
+  EXPECT_NEAR(x[0], exact(3.0)[0], 1.0e-12);
+}
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -9,6 +9,7 @@
 #include <array>
 #include <fstream>
 #include <functional>
+#include <optional>
 
 #include "mfem.hpp"
 
@@ -237,10 +238,11 @@ int which_kind_of_ode(serac::TimestepMethod m)
 }
 
 double first_order_ode_test(int nsteps, ode_type type, constraint_type constraint, TimestepMethod timestepper,
-                            DirichletEnforcementMethod enforcement)
+                            DirichletEnforcementMethod                    enforcement,
+                            const std::optional<AdaptiveTimestepOptions>& adaptivity = std::nullopt,
+                            int*                                          steps_taken = nullptr)
 {
   double t           = 0.0;
-  double dt          = 1.0 / nsteps;
   double previous_dt = -1.0;
   double c0;
 
@@ -318,8 +320,23 @@ double first_order_ode_test(int nsteps, ode_type type, constraint_type constrain
   soln[1] = 2.0;
   soln[2] = 3.0;
 
-  for (int i = 0; i < nsteps; i++) {
-    ode.Step(soln, t, dt);
+  if (adaptivity) {
+    // nsteps is ignored, the controller picks the steps needed to reach t = 1
+    ode.SetAdaptivity(*adaptivity, MPI_COMM_WORLD);
+    int steps = 0;
+    while (t < 1.0 - 1.0e-12) {
+      double step = 1.0 - t;
+      ode.Step(soln, t, step);
+      steps++;
+    }
+    if (steps_taken) {
+      *steps_taken = steps;
+    }
+  } else {
+    double dt = 1.0 / nsteps;
+    for (int i = 0; i < nsteps; i++) {
+      ode.Step(soln, t, dt);
+    }
   }
 
   // these solutions are computed to machine precision in
@@ -347,10 +364,11 @@ double first_order_ode_test(int nsteps, ode_type type, constraint_type constrain
 }
 
 double second_order_ode_test(int nsteps, ode_type type, constraint_type constraint, TimestepMethod timestepper,
-                             DirichletEnforcementMethod enforcement)
+                             DirichletEnforcementMethod                    enforcement,
+                             const std::optional<AdaptiveTimestepOptions>& adaptivity  = std::nullopt,
+                             int*                                          steps_taken = nullptr)
 {
-  double t  = 0.0;
-  double dt = 1.0 / nsteps;
+  double t = 0.0;
   double c0, c1;
 
   mfem::Vector x(3);
@@ -441,8 +459,23 @@ double second_order_ode_test(int nsteps, ode_type type, constraint_type constrai
     velocity[0] = 4.0;
   }
 
-  for (int i = 0; i < nsteps; i++) {
-    ode.Step(displacement, velocity, t, dt);
+  if (adaptivity) {
+    // nsteps is ignored, the controller picks the steps needed to reach t = 1
+    ode.SetAdaptivity(*adaptivity, MPI_COMM_WORLD);
+    int steps = 0;
+    while (t < 1.0 - 1.0e-12) {
+      double step = 1.0 - t;
+      ode.Step(displacement, velocity, t, step);
+      steps++;
+    }
+    if (steps_taken) {
+      *steps_taken = steps;
+    }
+  } else {
+    double dt = 1.0 / nsteps;
+    for (int i = 0; i < nsteps; i++) {
+      ode.Step(displacement, velocity, t, dt);
+    }
   }
 
   // these solutions are computed to machine precision in
@@ -554,6 +587,64 @@ INSTANTIATE_TEST_SUITE_P(all_first_order_tests, FirstOrderODE_suite,
 );
 // clang-format on
 
+/// the adaptive time stepping options for a relative tolerance, with the absolute tolerance scaled along with it
+AdaptiveTimestepOptions adaptivity_with_tolerance(double rel_tol)
+{
+  return {.rel_tol = rel_tol, .abs_tol = 1.0e-2 * rel_tol, .initial_dt = 0.01};
+}
+
+TEST(FirstOrderODE, adaptive)
+{
+  for (auto timestepper : {TimestepMethod::BackwardEuler, TimestepMethod::GeneralizedAlpha, TimestepMethod::SDIRK23,
+                           TimestepMethod::SDIRK34}) {
+    int    steps[2];
+    double errors[2];
+    for (int i : {0, 1}) {
+      errors[i] = first_order_ode_test(0, LINEAR, UNCONSTRAINED, timestepper, DirichletEnforcementMethod::RateControl,
+                                       adaptivity_with_tolerance(i == 0 ? 1.0e-3 : 1.0e-5), &steps[i]);
+    }
+
+    SLIC_INFO(axom::fmt::format("adaptive first order test({0}), errors: ({1}, {2}), steps: ({3}, {4})",
+                                to_string(timestepper), errors[0], errors[1], steps[0], steps[1]));
+
+    // the global error of a method of order p under control of its local error scales like tol^(p / (p + 1)),
+    // so a 100x tighter tolerance reduces it by at least 10x; we check against slightly less than that
+    EXPECT_LT(errors[1], 1.0e-3);
+    EXPECT_LT(5.0, errors[0] / errors[1]);
+    EXPECT_LT(steps[0], steps[1]);
+
+    // a fixed step run with the same number of steps is not more accurate than the adaptive one by much
+    double fixed_error =
+        first_order_ode_test(steps[1], LINEAR, UNCONSTRAINED, timestepper, DirichletEnforcementMethod::RateControl);
+    EXPECT_LT(errors[1], 10.0 * fixed_error);
+  }
+}
+
+TEST(SecondOrderODE, adaptive)
+{
+  // HHTAlpha and WBZAlpha are constructed with their default parameters, for which their error estimate holds
+  for (auto timestepper : {TimestepMethod::Newmark, TimestepMethod::HHTAlpha, TimestepMethod::WBZAlpha,
+                           TimestepMethod::FoxGoodwin}) {
+    int    steps[2];
+    double errors[2];
+    for (int i : {0, 1}) {
+      errors[i] = second_order_ode_test(0, LINEAR, UNCONSTRAINED, timestepper, DirichletEnforcementMethod::RateControl,
+                                        adaptivity_with_tolerance(i == 0 ? 1.0e-3 : 1.0e-5), &steps[i]);
+    }
+
+    SLIC_INFO(axom::fmt::format("adaptive second order test({0}), errors: ({1}, {2}), steps: ({3}, {4})",
+                                to_string(timestepper), errors[0], errors[1], steps[0], steps[1]));
+
+    EXPECT_LT(errors[1], 1.0e-3);
+    EXPECT_LT(5.0, errors[0] / errors[1]);
+    EXPECT_LT(steps[0], steps[1]);
+
+    double fixed_error =
+        second_order_ode_test(steps[1], LINEAR, UNCONSTRAINED, timestepper, DirichletEnforcementMethod::RateControl);
+    EXPECT_LT(errors[1], 10.0 * fixed_error);
+  }
+}
+
 class SecondOrderODE_suite : public testing::TestWithParam<param_t> {
 protected:
   void                       SetUp() override { std::tie(type, constraint, timestepper, enforcement) = GetParam(); }
@@ -0,0 +1,178 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "serac/numerics/preconditioner_reuse.hpp"
+
+#include "mfem.hpp"
+
+namespace serac {
+
+/// An identity "preconditioner" that counts how many times it has been set up
+class CountingPreconditioner : public mfem::Solver {
+public:
+  void SetOperator(const mfem::Operator& op) override
+  {
+    height = op.Height();
+    width  = op.Width();
+    num_setups++;
+  }
+  void Mult(const mfem::Vector& r, mfem::Vector& z) const override { z = r; }
+  int  num_setups = 0;
+};
+
+/// a diagonal matrix with distinct eigenvalues, so that unpreconditioned CG needs n iterations
+mfem::SparseMatrix diagonal_matrix(int n)
+{
+  mfem::SparseMatrix A(n, n);
+  for (int i = 0; i < n; i++) {
+    A.Add(i, i, 1.0 + i);
+  }
+  A.Finalize();
+  return A;
+}
+
+TEST(preconditioner_reuse, rebuild_interval)
+{
+  auto           A = diagonal_matrix(10);
+  mfem::CGSolver cg;
+  auto           counter = std::make_unique<CountingPreconditioner>();
+  auto&          setups  = counter->num_setups;
+
+  mfem_ext::ReusablePreconditioner prec(std::move(counter), cg, {.rebuild_interval = 3});
+  for (int i = 0; i < 7; i++) {
+    prec.SetOperator(A);
+  }
+  EXPECT_EQ(setups, 3);
+  EXPECT_EQ(prec.NumRebuilds(), 3);
+}
+
+TEST(preconditioner_reuse, rebuild_on_new_step)
+{
+  auto           A = diagonal_matrix(10);
+  mfem::CGSolver cg;
+  auto           counter = std::make_unique<CountingPreconditioner>();
+  auto&          setups  = counter->num_setups;
+
+  mfem_ext::ReusablePreconditioner prec(std::move(counter), cg, {.rebuild_interval = 0, .rebuild_on_new_step = true});
+  for (int i = 0; i < 3; i++) {
+    prec.SetOperator(A);
+  }
+  EXPECT_EQ(setups, 1);
+
+  prec.NewStep();
+  for (int i = 0; i < 3; i++) {
+    prec.SetOperator(A);
+  }
+  EXPECT_EQ(setups, 2);
+}
+
+TEST(preconditioner_reuse, rebuild_on_linear_iterations)
+{
+  constexpr int  n = 10;
+  auto           A = diagonal_matrix(n);
+  mfem::Vector   b(n), x(n);
+  mfem::CGSolver cg;
+  cg.SetRelTol(1.0e-12);
+  cg.SetMaxIter(2 * n);
+
+  for (auto [threshold, expected_setups] : {std::pair{n / 2, 2}, std::pair{2 * n, 1}}) {
+    auto  counter = std::make_unique<CountingPreconditioner>();
+    auto& setups  = counter->num_setups;
+
+    mfem_ext::ReusablePreconditioner prec(std::move(counter), cg,
+                                          {.rebuild_interval = 0, .max_linear_iterations = threshold});
+    cg.SetPreconditioner(prec);
+    cg.SetOperator(A);
+
+    b = 1.0;
+    x = 0.0;
+    cg.Mult(b, x);
+    EXPECT_TRUE(cg.GetConverged());
+
+    // unpreconditioned CG needs ~n iterations, which only exceeds the first threshold
+    cg.SetOperator(A);
+    EXPECT_EQ(setups, expected_setups);
+  }
+}
+
+/// the parallel matrix of -div(kappa grad u) + mu u on the given space
+std::unique_ptr<mfem::HypreParMatrix> diffusion_matrix(mfem::ParFiniteElementSpace& fes, double kappa, double mu)
+{
+  mfem::ConstantCoefficient kappa_coef(kappa);
+  mfem::ConstantCoefficient mu_coef(mu);
+  mfem::ParBilinearForm     form(&fes);
+  form.AddDomainIntegrator(new mfem::DiffusionIntegrator(kappa_coef));
+  form.AddDomainIntegrator(new mfem::MassIntegrator(mu_coef));
+  form.Assemble();
+  form.Finalize();
+  return std::unique_ptr<mfem::HypreParMatrix>(form.ParallelAssemble());
+}
+
+TEST(preconditioner_reuse, frozen_amg_hierarchy)
+{
+  auto                        serial_mesh = mfem::Mesh::MakeCartesian2D(16, 16, mfem::Element::QUADRILATERAL);
+  mfem::ParMesh               mesh(MPI_COMM_WORLD, serial_mesh);
+  mfem::H1_FECollection       fec(1, 2);
+  mfem::ParFiniteElementSpace fes(&mesh, &fec);
+
+  auto A1 = diffusion_matrix(fes, 1.0, 1.0);
+  auto A2 = diffusion_matrix(fes, 1.5, 2.0);
+
+  mfem::CGSolver cg(MPI_COMM_WORLD);
+  cg.SetRelTol(1.0e-10);
+  cg.SetMaxIter(100);
+
+  auto amg = std::make_unique<mfem_ext::FrozenHierarchyAMG>();
+  amg->SetPrintLevel(0);
+
+  mfem_ext::ReusablePreconditioner prec(std::move(amg), cg, {.rebuild_interval = 0, .freeze_amg_hierarchy = true});
+  cg.SetPreconditioner(prec);
+
+  mfem::Vector b(A1->Height()), x(A1->Height()), r(A1->Height());
+  b.Randomize(1);
+
+  for (auto* A : {A1.get(), A2.get()}) {
+    cg.SetOperator(*A);
+
+    x = 0.0;
+    cg.Mult(b, x);
+    EXPECT_TRUE(cg.GetConverged());
+
+    // the refreshed preconditioner solves the new system, not the one its hierarchy was built from
+    A->Mult(x, r);
+    r -= b;
+    EXPECT_LT(mfem::InnerProduct(MPI_COMM_WORLD, r, r), 1.0e-12 * mfem::InnerProduct(MPI_COMM_WORLD, b, b));
+  }
+
+  // the second operator only refreshed the fine-level matrix of the hierarchy
+  EXPECT_EQ(prec.NumRebuilds(), 1);
+}
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -0,0 +1,105 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "serac/numerics/recycling_solver.hpp"
+
+#include "mfem.hpp"
+
+namespace serac {
+
+/// a diagonal matrix with distinct eigenvalues, shifted by a small amount for each system in a sequence
+mfem::SparseMatrix shifted_diagonal_matrix(int n, double shift)
+{
+  mfem::SparseMatrix A(n, n);
+  for (int i = 0; i < n; i++) {
+    A.Add(i, i, 1.0 + i + shift);
+  }
+  A.Finalize();
+  return A;
+}
+
+/// solves a slowly varying sequence of systems, returning the total number of Krylov iterations
+int solve_sequence(mfem::IterativeSolver& solver)
+{
+  constexpr int n           = 50;
+  constexpr int num_solves  = 5;
+  int           total_iters = 0;
+  mfem::Vector  b(n), x(n), r(n);
+
+  for (int k = 0; k < num_solves; k++) {
+    auto A = shifted_diagonal_matrix(n, 1.0e-3 * k);
+    for (int i = 0; i < n; i++) {
+      b(i) = 1.0 + 0.1 * std::sin(i + 0.01 * k);
+    }
+
+    solver.SetOperator(A);
+    x = 0.0;
+    solver.Mult(b, x);
+    EXPECT_TRUE(solver.GetConverged());
+    total_iters += solver.GetNumIterations();
+
+    A.Mult(x, r);
+    r -= b;
+    EXPECT_LT(r.Norml2(), 1.0e-8 * b.Norml2());
+  }
+  return total_iters;
+}
+
+template <typename KrylovSolver>
+std::unique_ptr<mfem::IterativeSolver> krylov_solver()
+{
+  auto solver = std::make_unique<KrylovSolver>();
+  solver->SetRelTol(1.0e-10);
+  solver->SetAbsTol(0.0);
+  solver->SetMaxIter(200);
+  return solver;
+}
+
+template <typename KrylovSolver>
+void check_recycling(bool symmetric)
+{
+  auto plain_solver = krylov_solver<KrylovSolver>();
+  int  plain_iters  = solve_sequence(*plain_solver);
+
+  mfem_ext::RecyclingKrylovSolver recycling_solver(MPI_COMM_WORLD, krylov_solver<KrylovSolver>(), 3, symmetric);
+  recycling_solver.SetRelTol(1.0e-10);
+  recycling_solver.SetAbsTol(0.0);
+  recycling_solver.SetMaxIter(200);
+  int recycled_iters = solve_sequence(recycling_solver);
+
+  EXPECT_EQ(recycling_solver.RecycledDimension(), 3);
+  EXPECT_LT(recycled_iters, plain_iters);
+}
+
+TEST(recycling_solver, deflated_cg) { check_recycling<mfem::CGSolver>(true); }
+
+TEST(recycling_solver, recycled_gmres) { check_recycling<mfem::GMRESSolver>(false); }
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -0,0 +1,109 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cmath>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "serac/numerics/equation_solver.hpp"
+
+#include "mfem.hpp"
+
+namespace serac {
+
+constexpr int size = 20;
+
+/// a diagonally dominant circulant matrix that couples each row to the rows @a offset apart, scaled by @a scale,
+/// so every offset has the same number of entries
+class TestMatrix {
+public:
+  TestMatrix(int offset, double scale) : local_(size, size)
+  {
+    for (int i = 0; i < size; i++) {
+      local_.Add(i, i, scale * (4.0 + 0.1 * i));
+      local_.Add(i, (i + offset) % size, -scale);
+      local_.Add(i, (i + size - offset) % size, -scale);
+    }
+    local_.Finalize();
+    matrix_ = std::make_unique<mfem::HypreParMatrix>(MPI_COMM_WORLD, HYPRE_BigInt(size), row_starts_, &local_);
+  }
+
+  const mfem::HypreParMatrix& operator*() const { return *matrix_; }
+
+private:
+  HYPRE_BigInt                          row_starts_[2] = {0, size};
+  mfem::SparseMatrix                    local_;
+  std::unique_ptr<mfem::HypreParMatrix> matrix_;
+};
+
+/// factors @a A with @a solver and checks the solution of A x = b
+void check_solution(mfem_ext::SuperLUSolver& solver, const TestMatrix& A)
+{
+  mfem::Vector b(size), x(size), r(size);
+  for (int i = 0; i < size; i++) {
+    b(i) = 1.0 + std::sin(i);
+  }
+
+  solver.SetOperator(*A);
+  solver.Mult(b, x);
+
+  (*A).Mult(x, r);
+  r -= b;
+  EXPECT_LT(r.Norml2(), 1.0e-12 * b.Norml2());
+}
+
+TEST(superlu_solver, reuses_symbolic_factorization_for_same_pattern)
+{
+  mfem_ext::SuperLUSolver solver(MPI_COMM_WORLD);
+  solver.SetPrintStatistics(false);
+
+  check_solution(solver, TestMatrix(1, 1.0));
+  EXPECT_EQ(solver.NumSymbolicFactorizations(), 1);
+
+  // new values in the same pattern are only refactored numerically
+  check_solution(solver, TestMatrix(1, 2.0));
+  EXPECT_EQ(solver.NumSymbolicFactorizations(), 1);
+
+  // a different pattern with the same size and number of entries needs a new symbolic factorization
+  check_solution(solver, TestMatrix(2, 1.0));
+  EXPECT_EQ(solver.NumSymbolicFactorizations(), 2);
+
+  check_solution(solver, TestMatrix(2, 3.0));
+  EXPECT_EQ(solver.NumSymbolicFactorizations(), 2);
+}
+
+TEST(superlu_solver, refactors_symbolically_without_reuse)
+{
+  mfem_ext::SuperLUSolver solver(MPI_COMM_WORLD, false);
+  solver.SetPrintStatistics(false);
+
+  check_solution(solver, TestMatrix(1, 1.0));
+  check_solution(solver, TestMatrix(1, 2.0));
+  EXPECT_EQ(solver.NumSymbolicFactorizations(), 2);
+}
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  int result = 0;
+
+  ::testing::InitGoogleTest(&argc, argv);
+
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;  // create & initialize test logger, finalized when
+                                    // exiting main scope
+  result = RUN_ALL_TESTS();
+
+  MPI_Finalize();
+
+  return result;
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/numerics/timestep_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac::mfem_ext {
+
+TimestepController::TimestepController(const AdaptiveTimestepOptions& options, MPI_Comm comm)
+    : options_(options), comm_(comm), next_dt_(options.initial_dt)
+{
+  SLIC_ERROR_ROOT_IF(options_.rel_tol <= 0.0 && options_.abs_tol <= 0.0,
+                     "Adaptive time stepping requires a positive relative or absolute tolerance");
+  SLIC_ERROR_ROOT_IF(options_.max_shrink <= 0.0 || options_.max_shrink >= 1.0 || options_.max_growth <= 1.0,
+                     "Adaptive time stepping requires 0 < max_shrink < 1 < max_growth");
+}
+
+double TimestepController::ErrorNorm(const mfem::Vector& error, const mfem::Vector& x_old,
+                                     const mfem::Vector& x_new) const
+{
+  double sums[2] = {0.0, static_cast<double>(error.Size())};
+  for (int i = 0; i < error.Size(); i++) {
+    const double weight = options_.abs_tol + options_.rel_tol * std::max(std::abs(x_old(i)), std::abs(x_new(i)));
+    sums[0] += (error(i) / weight) * (error(i) / weight);
+  }
+  MPI_Allreduce(MPI_IN_PLACE, sums, 2, MPI_DOUBLE, MPI_SUM, comm_);
+  return (sums[1] > 0.0) ? std::sqrt(sums[0] / sums[1]) : 0.0;
+}
+
+double TimestepController::Proposal(double dt_max) const
+{
+  return (next_dt_ > 0.0) ? std::min(next_dt_, dt_max) : dt_max;
+}
+
+bool TimestepController::Accept(double error_norm, double dt)
+{
+  // a vanishing error estimate is treated as a very small one, so the growth limit applies
+  constexpr double min_error = 1.0e-10;
+
+  const double k        = order_;
+  const double error    = std::isfinite(error_norm) ? std::max(error_norm, min_error) : 1.0 / min_error;
+  const bool   accepted = (error <= 1.0);
+
+  double factor = options_.safety_factor * std::pow(error, -1.0 / k);
+  if (accepted && previous_error_ > 0.0) {
+    factor = options_.safety_factor * std::pow(error, -0.7 / k) * std::pow(previous_error_, 0.4 / k);
+  }
+
+  if (accepted) {
+    next_dt_                = std::clamp(factor, options_.max_shrink, options_.max_growth) * dt;
+    previous_error_         = error;
+    consecutive_rejections_ = 0;
+  } else {
+    // a rejected step must be retried with a strictly smaller step
+    Reject(std::clamp(factor, options_.max_shrink, options_.safety_factor) * dt);
+  }
+  return accepted;
+}
+
+void TimestepController::Cutback(double dt) { Reject(options_.nonlinear_failure_cutback * dt); }
+
+void TimestepController::Reject(double next_dt)
+{
+  next_dt_        = next_dt;
+  previous_error_ = 0.0;
+  num_rejections_++;
+  consecutive_rejections_++;
+  SLIC_ERROR_ROOT_IF(next_dt_ < options_.min_dt,
+                     "Adaptive time step fell below the minimum step size " << options_.min_dt);
+  SLIC_ERROR_ROOT_IF(consecutive_rejections_ > options_.max_rejections,
+                     "Adaptive time step was rejected " << consecutive_rejections_ << " times in a row");
+}
+
+void TimestepController::DefineInputFileSchema(axom::inlet::Container& container)
+{
+  container.addDouble("rel_tol", "Relative tolerance of the local error estimate.").defaultValue(1.0e-3);
+  container.addDouble("abs_tol", "Absolute tolerance of the local error estimate.").defaultValue(1.0e-6);
+  container.addDouble("initial_dt", "Size of the first step attempted, 0 for the requested step.").defaultValue(0.0);
+  container.addDouble("min_dt", "Smallest step size before the simulation is aborted.").defaultValue(1.0e-12);
+  container.addDouble("max_growth", "Largest factor the step size may grow by after a step.").defaultValue(5.0);
+  container.addDouble("max_shrink", "Smallest factor the step size may shrink by after a rejection.")
+      .defaultValue(0.1);
+  container
+      .addDouble("nonlinear_failure_cutback", "Factor the step size is cut back by when the nonlinear solve fails.")
+      .defaultValue(0.25);
+  container.addInt("max_rejections", "Maximum number of consecutive rejections of a step.").defaultValue(10);
+}
+
+}  // namespace serac::mfem_ext
+
+serac::AdaptiveTimestepOptions FromInlet<serac::AdaptiveTimestepOptions>::operator()(
+    const axom::inlet::Container& base)
+{
+  serac::AdaptiveTimestepOptions options;
+  options.rel_tol                   = base["rel_tol"];
+  options.abs_tol                   = base["abs_tol"];
+  options.initial_dt                = base["initial_dt"];
+  options.min_dt                    = base["min_dt"];
+  options.max_growth                = base["max_growth"];
+  options.max_shrink                = base["max_shrink"];
+  options.nonlinear_failure_cutback = base["nonlinear_failure_cutback"];
+  options.max_rejections            = base["max_rejections"];
+  return options;
+}
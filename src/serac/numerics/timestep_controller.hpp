@@ -0,0 +1,124 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file timestep_controller.hpp
+ *
+ * @brief Step size selection for error-controlled adaptive time integration
+ */
+
+#pragma once
+
+#include "mfem.hpp"
+
+#include "serac/infrastructure/input.hpp"
+#include "serac/numerics/solver_config.hpp"
+
+namespace serac::mfem_ext {
+
+/**
+ * @brief Chooses the step sizes of an adaptive time integration from local error estimates
+ *
+ * Accepted steps use the PI controller of Gustafsson,
+ * dt_new = safety * dt * err_n^(-0.7/k) * err_{n-1}^(0.4/k),
+ * where k is the order of the error estimate (the local error is O(dt^k)), which gives smoother step size
+ * sequences than the elementary controller dt_new = safety * dt * err_n^(-1/k). The elementary controller is
+ * used for the first step and after rejections, where no meaningful previous error is available.
+ */
+class TimestepController {
+public:
+  /**
+   * @brief Constructs the controller
+   * @param[in] options The adaptivity parameters
+   * @param[in] comm The MPI communicator the solution vectors are distributed over
+   */
+  TimestepController(const AdaptiveTimestepOptions& options, MPI_Comm comm);
+
+  /**
+   * @brief Sets the order of the error estimate, i.e. the local error estimate is O(dt^order)
+   * @param[in] order The order
+   */
+  void SetOrder(int order) { order_ = order; }
+
+  /**
+   * @brief The weighted RMS norm of a local error estimate, which is at most one for acceptable steps
+   * @param[in] error The local error estimate
+   * @param[in] x_old The solution at the start of the step
+   * @param[in] x_new The solution at the end of the step
+   */
+  double ErrorNorm(const mfem::Vector& error, const mfem::Vector& x_old, const mfem::Vector& x_new) const;
+
+  /**
+   * @brief The step size to attempt next
+   * @param[in] dt_max The largest step size allowed, e.g. the time remaining until the next output
+   */
+  double Proposal(double dt_max) const;
+
+  /**
+   * @brief Decides whether a completed step is accepted, and chooses the size of the next attempt
+   * @param[in] error_norm The error norm of the step
+   * @param[in] dt The size of the step
+   * @return Whether the step is accepted
+   */
+  bool Accept(double error_norm, double dt);
+
+  /**
+   * @brief Chooses a smaller size for the next attempt after the nonlinear solve of a step failed
+   * @param[in] dt The size of the failed step
+   */
+  void Cutback(double dt);
+
+  /**
+   * @brief The total number of rejected steps
+   */
+  int NumRejections() const { return num_rejections_; }
+
+  /**
+   * @brief Input file parameters for adaptive time stepping
+   */
+  static void DefineInputFileSchema(axom::inlet::Container& container);
+
+private:
+  /**
+   * @brief Records a rejected step, and aborts if the step size or the number of rejections exceed their limits
+   * @param[in] next_dt The size of the next attempt
+   */
+  void Reject(double next_dt);
+
+  /// @brief The adaptivity parameters
+  AdaptiveTimestepOptions options_;
+
+  /// @brief The MPI communicator the solution vectors are distributed over
+  MPI_Comm comm_;
+
+  /// @brief The order of the error estimate
+  int order_ = 1;
+
+  /// @brief The size of the next attempted step, or 0 before the first step
+  double next_dt_ = 0.0;
+
+  /// @brief The error norm of the previous accepted step, or 0 if the next step cannot use it
+  double previous_error_ = 0.0;
+
+  /// @brief The total number of rejected steps
+  int num_rejections_ = 0;
+
+  /// @brief The number of rejections since the last accepted step
+  int consecutive_rejections_ = 0;
+};
+
+}  // namespace serac::mfem_ext
+
+/**
+ * @brief Prototype the specialization for Inlet parsing
+ *
+ * @tparam The object to be created by inlet
+ */
+template <>
+struct FromInlet<serac::AdaptiveTimestepOptions> {
+  /// @brief Returns created object from Inlet container
+  serac::AdaptiveTimestepOptions operator()(const axom::inlet::Container& base);
+};
@@ -33,11 +33,16 @@ BoundaryCondition::BoundaryCondition(GeneralCoefficient coef, const std::optiona
   }
 }
 
-void BoundaryCondition::setTrueDofs(const mfem::Array<int> dofs) { true_dofs_ = dofs; }
+void BoundaryCondition::setTrueDofs(const mfem::Array<int> dofs)
+{
+  true_dofs_ = dofs;
+  dof_evaluation_points_.reset();
+}
 
 void BoundaryCondition::setTrueDofs(FiniteElementState& state)
 {
   true_dofs_.emplace(0);
+  dof_evaluation_points_.reset();
   state_ = &state;
   if (component_) {
     state.space().GetEssentialTrueDofs(markers_, *true_dofs_, *component_);
@@ -118,11 +123,226 @@ void BoundaryCondition::projectBdr(const double time) const
 
 void BoundaryCondition::projectBdrToDofs(mfem::Vector& dof_values, const double time) const
 {
+  if (nodal_function_) {
+    const auto&  cache = dofEvaluationPoints();
+    mfem::Vector point_values(static_cast<int>(cache.true_dofs.size()));
+    nodal_function_(cache, time, point_values);
+    scatterToDofs(cache, point_values, dof_values);
+  } else {
+    evaluateAtDofs(coef_, dof_values, time);
+  }
+}
+
+void BoundaryCondition::projectBdrTimeDerivativeToDofs(mfem::Vector& dof_values, const double time,
+                                                       const int derivative) const
+{
+  SLIC_ERROR_ROOT_IF(!hasTimeDerivative(derivative),
+                     "No time derivative of order " << derivative << " was supplied for this boundary condition.");
+  evaluateAtDofs((derivative == 1) ? *rate_coef_ : *second_rate_coef_, dof_values, time);
+}
+
+void BoundaryCondition::setTimeDerivatives(GeneralCoefficient first, std::optional<GeneralCoefficient> second)
+{
+  SLIC_ERROR_ROOT_IF(is_vector_valued(first) != is_vector_valued(coef_) ||
+                         (second && is_vector_valued(*second) != is_vector_valued(coef_)),
+                     "The time derivatives of a boundary condition must have the same kind of coefficient.");
+  rate_coef_        = std::move(first);
+  second_rate_coef_ = std::move(second);
+}
+
+const BoundaryCondition::DofEvaluationPoints& BoundaryCondition::dofEvaluationPoints() const
+{
+  if (dof_evaluation_points_) {
+    return *dof_evaluation_points_;
+  }
+
   SLIC_ERROR_ROOT_IF(!state_, "Boundary condition must be associated with a FiniteElementState.");
-  auto gf = state_->gridFunc();
-  gf.SetFromTrueDofs(dof_values);
-  projectBdr(gf, time);
-  gf.GetTrueDofs(dof_values);
+  const auto& space = std::as_const(*state_).space();
+  auto&       mesh  = *state_->space().GetParMesh();
+
+  DofEvaluationPoints cache{.vdim          = space.GetVDim(),
+                            .dim           = mesh.SpaceDimension(),
+                            .elements      = {},
+                            .points        = {},
+                            .coordinates   = {},
+                            .true_dofs     = {},
+                            .shared_vdofs  = {},
+                            .received_dofs = {},
+                            .exchange      = false};
+
+  // each constrained true DOF is evaluated once, at its node on the first boundary element that owns it
+  std::vector<bool> unvisited(static_cast<std::size_t>(space.GetTrueVSize()), false);
+  for (int tdof : *true_dofs_) {
+    unvisited[static_cast<std::size_t>(tdof)] = true;
+  }
+
+  // a constrained DOF that this rank shares but does not own may be on a marked boundary element here while
+  // its owner has no marked boundary element touching it, so its value is also kept for the owner
+  std::vector<bool> unsent(static_cast<std::size_t>(space.GetVSize()), true);
+
+  mfem::Array<int> vdofs;
+  mfem::Vector     x(cache.dim);
+  for (int be = 0; be < mesh.GetNBE(); be++) {
+    if (markers_[mesh.GetBdrAttribute(be) - 1] == 0) {
+      continue;
+    }
+    space.GetBdrElementVDofs(be, vdofs);
+    const auto& nodes = space.GetBE(be)->GetNodes();
+    const int   ndofs = nodes.GetNPoints();
+
+    for (int j = 0; j < ndofs; j++) {
+      bool needed = false;
+      for (int c = 0; c < cache.vdim; c++) {
+        const int  vdof        = vdofs[c * ndofs + j];
+        const int  ldof        = vdof >= 0 ? vdof : -1 - vdof;
+        const int  tdof        = space.GetLocalTDofNumber(ldof);
+        const bool constrained = !component_ || *component_ == c;
+        needed = needed || (tdof >= 0 && unvisited[static_cast<std::size_t>(tdof)]) ||
+                 (tdof < 0 && constrained && unsent[static_cast<std::size_t>(ldof)]);
+      }
+      if (!needed) {
+        continue;
+      }
+
+      cache.elements.push_back(be);
+      cache.points.push_back(nodes.IntPoint(j));
+
+      auto& T = *mesh.GetBdrElementTransformation(be);
+      T.SetIntPoint(&nodes.IntPoint(j));
+      T.Transform(nodes.IntPoint(j), x);
+      cache.coordinates.insert(cache.coordinates.end(), x.begin(), x.end());
+      for (int c = 0; c < cache.vdim; c++) {
+        const int  vdof        = vdofs[c * ndofs + j];
+        const int  ldof        = vdof >= 0 ? vdof : -1 - vdof;
+        const int  tdof        = space.GetLocalTDofNumber(ldof);
+        const bool constrained = !component_ || *component_ == c;
+        if (tdof >= 0 && unvisited[static_cast<std::size_t>(tdof)]) {
+          unvisited[static_cast<std::size_t>(tdof)] = false;
+          cache.true_dofs.push_back(tdof);
+        } else {
+          cache.true_dofs.push_back(-1);
+        }
+        if (tdof < 0 && constrained && unsent[static_cast<std::size_t>(ldof)]) {
+          unsent[static_cast<std::size_t>(ldof)] = false;
+          cache.shared_vdofs.push_back(ldof);
+        } else {
+          cache.shared_vdofs.push_back(-1);
+        }
+      }
+    }
+  }
+
+  // the owned constrained DOFs that no local boundary element reached receive their values from the other ranks
+  for (int ldof = 0; ldof < space.GetVSize(); ldof++) {
+    const int tdof = space.GetLocalTDofNumber(ldof);
+    if (tdof >= 0 && unvisited[static_cast<std::size_t>(tdof)]) {
+      unvisited[static_cast<std::size_t>(tdof)] = false;
+      cache.received_dofs.emplace_back(ldof, tdof);
+    }
+  }
+
+  int exchange = cache.received_dofs.empty() ? 0 : 1;
+  MPI_Allreduce(MPI_IN_PLACE, &exchange, 1, MPI_INT, MPI_MAX, mesh.GetComm());
+  cache.exchange = (exchange != 0);
+
+  // without an exchange, the points that only carry values for other ranks are not needed
+  if (!cache.exchange) {
+    const auto  vdim = static_cast<std::size_t>(cache.vdim);
+    const auto  dim  = static_cast<std::size_t>(cache.dim);
+    std::size_t kept = 0;
+    for (std::size_t p = 0; p < cache.points.size(); p++) {
+      bool owned = false;
+      for (std::size_t c = 0; c < vdim; c++) {
+        owned = owned || (cache.true_dofs[p * vdim + c] >= 0);
+      }
+      if (!owned) {
+        continue;
+      }
+      cache.elements[kept] = cache.elements[p];
+      cache.points[kept]   = cache.points[p];
+      std::copy_n(&cache.coordinates[p * dim], dim, &cache.coordinates[kept * dim]);
+      std::copy_n(&cache.true_dofs[p * vdim], vdim, &cache.true_dofs[kept * vdim]);
+      kept++;
+    }
+    cache.elements.resize(kept);
+    cache.points.resize(kept);
+    cache.coordinates.resize(kept * dim);
+    cache.true_dofs.resize(kept * vdim);
+    cache.shared_vdofs.clear();
+  }
+
+  dof_evaluation_points_ = std::move(cache);
+  return *dof_evaluation_points_;
+}
+
+void BoundaryCondition::evaluateAtDofs(const GeneralCoefficient& coef, mfem::Vector& dof_values,
+                                       const double time) const
+{
+  const auto& cache = dofEvaluationPoints();
+  auto&       mesh  = *state_->space().GetParMesh();
+
+  mfem::Vector point_values(static_cast<int>(cache.true_dofs.size()));
+  if (is_vector_valued(coef)) {
+    auto& vec_coef = *get<std::shared_ptr<mfem::VectorCoefficient>>(coef);
+    vec_coef.SetTime(time);
+    mfem::Vector value;
+    for (std::size_t p = 0; p < cache.points.size(); p++) {
+      auto& T = *mesh.GetBdrElementTransformation(cache.elements[p]);
+      T.SetIntPoint(&cache.points[p]);
+      value.SetDataAndSize(&point_values[static_cast<int>(p) * cache.vdim], cache.vdim);
+      vec_coef.Eval(value, T, cache.points[p]);
+    }
+  } else {
+    // a scalar coefficient is written to each component of the point, only the constrained one is used
+    auto& scalar_coef = *get<std::shared_ptr<mfem::Coefficient>>(coef);
+    scalar_coef.SetTime(time);
+    for (std::size_t p = 0; p < cache.points.size(); p++) {
+      auto& T = *mesh.GetBdrElementTransformation(cache.elements[p]);
+      T.SetIntPoint(&cache.points[p]);
+      const double value = scalar_coef.Eval(T, cache.points[p]);
+      for (int c = 0; c < cache.vdim; c++) {
+        point_values[static_cast<int>(p) * cache.vdim + c] = value;
+      }
+    }
+  }
+
+  scatterToDofs(cache, point_values, dof_values);
+}
+
+void BoundaryCondition::scatterToDofs(const DofEvaluationPoints& points, const mfem::Vector& point_values,
+                                      mfem::Vector& dof_values) const
+{
+  for (std::size_t i = 0; i < points.true_dofs.size(); i++) {
+    if (points.true_dofs[i] >= 0) {
+      dof_values[points.true_dofs[i]] = point_values[static_cast<int>(i)];
+    }
+  }
+
+  if (!points.exchange) {
+    return;
+  }
+
+  // like ParGridFunction::ProjectBdrCoefficient, the owner of each shared DOF averages the values of the ranks
+  // that evaluated it. Only the owner writes a true DOF, so the reduction does not need to be broadcast back.
+  auto&        space = state_->space();
+  mfem::Vector sums(space.GetVSize()), counts(space.GetVSize());
+  sums   = 0.0;
+  counts = 0.0;
+  for (std::size_t i = 0; i < points.shared_vdofs.size(); i++) {
+    if (points.shared_vdofs[i] >= 0) {
+      sums[points.shared_vdofs[i]]   = point_values[static_cast<int>(i)];
+      counts[points.shared_vdofs[i]] = 1.0;
+    }
+  }
+
+  auto& gcomm = space.GroupComm();
+  gcomm.Reduce<double>(sums.GetData(), mfem::GroupCommunicator::Sum<double>);
+  gcomm.Reduce<double>(counts.GetData(), mfem::GroupCommunicator::Sum<double>);
+
+  for (auto [ldof, tdof] : points.received_dofs) {
+    SLIC_ERROR_IF(counts[ldof] == 0.0, "A constrained true DOF is not on a marked boundary element of any rank.");
+    dof_values[tdof] = sums[ldof] / counts[ldof];
+  }
 }
 
 void BoundaryCondition::eliminateFromMatrix(mfem::HypreParMatrix& k_mat) const
@@ -12,14 +12,17 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <set>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 #include "serac/infrastructure/logger.hpp"
+#include "serac/numerics/functional/tensor.hpp"
 #include "serac/physics/state/finite_element_state.hpp"
 
 namespace serac {
@@ -190,13 +193,83 @@ public:
 
   /**
    * @brief Projects the boundary condition over boundary to a DoF vector
-   * @param[in] dof_values The discrete dof values to project
+   *
+   * Only the entries of the constrained true DOFs are written. The coefficient is evaluated directly at the
+   * nodes of those DOFs, which are located once and cached, rather than projected over every boundary element.
+   *
+   * @param[inout] dof_values The discrete dof values to project
    * @param[in] time The time for the coefficient, used for time-varying coefficients
    * @pre A corresponding field (FiniteElementState) has been associated
    * with the calling object via BoundaryCondition::setTrueDofs(FiniteElementState&)
    */
   void projectBdrToDofs(mfem::Vector& dof_values, const double time) const;
 
+  /**
+   * @brief Supplies a q-function-style definition of the boundary condition for projectBdrToDofs
+   *
+   * The callable is evaluated in a single pass over the cached coordinates of the nodes of the constrained true DOFs,
+   * with the per-point calls inlined, instead of through the coefficient and an element transformation per node. The
+   * coefficient is still used by the projections over boundary elements, so both must describe the same values.
+   *
+   * @tparam dim The spatial dimension of the mesh
+   * @tparam Func The type of the callable, invoked as f(tensor<double, dim> x, double t)
+   * @param[in] f The callable, returning a double for a scalar condition (or a single component of a vector field),
+   * or a tensor<double, vdim> for a condition on all components of a vector field
+   */
+  template <int dim, typename Func>
+  void setNodalFunction(Func f)
+  {
+    nodal_function_ = [f](const DofEvaluationPoints& points, const double time, mfem::Vector& point_values) {
+      SLIC_ERROR_ROOT_IF(points.dim != dim, "The nodal function of a boundary condition must match the mesh dimension");
+      const int vdim = points.vdim;
+      for (std::size_t p = 0; p < points.coordinates.size() / static_cast<std::size_t>(dim); p++) {
+        const double* coordinates = &points.coordinates[p * static_cast<std::size_t>(dim)];
+        const auto    value       = f(make_tensor<dim>([coordinates](int i) { return coordinates[i]; }), time);
+        double*       values      = &point_values[static_cast<int>(p) * vdim];
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>) {
+          // like a scalar coefficient, the value is written to each component and only the constrained one is used
+          for (int c = 0; c < vdim; c++) {
+            values[c] = value;
+          }
+        } else {
+          SLIC_ERROR_ROOT_IF(components(value) != vdim,
+                             "The nodal function of a boundary condition must return a value for every component");
+          for (int c = 0; c < vdim; c++) {
+            values[c] = value[c];
+          }
+        }
+      }
+    };
+  }
+
+  /**
+   * @brief Projects a time derivative of the boundary condition to the constrained entries of a DoF vector
+   * @param[inout] dof_values The discrete dof values to project
+   * @param[in] time The time at which the derivative is evaluated
+   * @param[in] derivative The order of the time derivative, 1 or 2
+   * @pre The derivative was supplied with BoundaryCondition::setTimeDerivatives
+   */
+  void projectBdrTimeDerivativeToDofs(mfem::Vector& dof_values, const double time, const int derivative) const;
+
+  /**
+   * @brief Supplies the analytic time derivatives of the boundary condition
+   *
+   * Time integrators use these instead of finite differences of the boundary condition in time.
+   *
+   * @param[in] first The first time derivative of the coefficient
+   * @param[in] second The second time derivative of the coefficient, if available
+   */
+  void setTimeDerivatives(GeneralCoefficient first, std::optional<GeneralCoefficient> second = std::nullopt);
+
+  /**
+   * @brief Whether an analytic time derivative of the given order was supplied
+   * @param[in] derivative The order of the time derivative, 1 or 2
+   */
+  bool hasTimeDerivative(const int derivative) const
+  {
+    return (derivative == 1) ? rate_coef_.has_value() : (derivative == 2) && second_rate_coef_.has_value();
+  }
+
   /**
    * @brief Eliminates the rows and columns corresponding to the BC's true DOFS
    * from a stiffness matrix
@@ -237,10 +310,102 @@ public:
   void setTime(const double time);
 
 private:
+  /**
+   * @brief The locations at which a coefficient is evaluated to find the values of the constrained true DOFs
+   */
+  struct DofEvaluationPoints {
+    /**
+     * @brief The number of vector components of the field
+     */
+    int vdim;
+    /**
+     * @brief The spatial dimension of the mesh
+     */
+    int dim;
+    /**
+     * @brief The boundary element each point is evaluated on
+     */
+    std::vector<int> elements;
+    /**
+     * @brief The location of each point in the reference boundary element
+     */
+    std::vector<mfem::IntegrationPoint> points;
+    /**
+     * @brief The physical coordinates of each point
+     */
+    std::vector<double> coordinates;
+    /**
+     * @brief The local true DOF of each vector component at each point, or -1 if that component is not constrained
+     */
+    std::vector<int> true_dofs;
+    /**
+     * @brief The local (non-owned) DOF of each vector component at each point whose value is sent to the rank
+     * that owns it, or -1
+     */
+    std::vector<int> shared_vdofs;
+    /**
+     * @brief The local DOF and true DOF of each owned constrained DOF whose value is received from other ranks
+     */
+    std::vector<std::pair<int, int>> received_dofs;
+    /**
+     * @brief Whether any rank receives values, in which case every rank takes part in the exchange
+     */
+    bool exchange;
+  };
+
+  /**
+   * @brief The number of components of a vector value of a nodal function
+   */
+  template <int n>
+  static constexpr int components(const tensor<double, n>&)
+  {
+    return n;
+  }
+
+  /**
+   * @brief Returns the evaluation points of the constrained true DOFs, locating them on the first call
+   */
+  const DofEvaluationPoints& dofEvaluationPoints() const;
+
+  /**
+   * @brief Evaluates a coefficient at the constrained true DOFs
+   * @param[in] coef The coefficient to evaluate
+   * @param[inout] dof_values The discrete dof values, only the constrained entries are written
+   * @param[in] time The time for the coefficient
+   */
+  void evaluateAtDofs(const GeneralCoefficient& coef, mfem::Vector& dof_values, const double time) const;
+
+  /**
+   * @brief Writes the values at the evaluation points to the constrained true DOFs
+   *
+   * A constrained DOF can be owned by a rank whose boundary elements do not reach it, when the boundary element
+   * that marks it is on a neighboring rank. Those values are summed onto their owners over the shared groups.
+   *
+   * @param[in] points The evaluation points
+   * @param[in] point_values The value of each vector component at each point
+   * @param[inout] dof_values The discrete dof values, only the constrained entries are written
+   * @note This is collective when DofEvaluationPoints::exchange is set
+   */
+  void scatterToDofs(const DofEvaluationPoints& points, const mfem::Vector& point_values,
+                     mfem::Vector& dof_values) const;
+
   /**
    * @brief A coefficient containing either a mfem::Coefficient or an mfem::VectorCoefficient
    */
   GeneralCoefficient coef_;
+  /**
+   * @brief The analytic first time derivative of the coefficient, if supplied
+   */
+  std::optional<GeneralCoefficient> rate_coef_;
+  /**
+   * @brief The analytic second time derivative of the coefficient, if supplied
+   */
+  std::optional<GeneralCoefficient> second_rate_coef_;
+  /**
+   * @brief The q-function-style definition of the BC, which writes the value of each vector component at each of
+   * the cached evaluation points, if supplied
+   */
+  std::function<void(const DofEvaluationPoints&, const double, mfem::Vector&)> nodal_function_;
   /**
    * @brief The vector component affected by this BC (empty implies all components)
    */
@@ -259,6 +424,11 @@ private:
    * @note Only used for essential (Dirichlet) BCs
    */
   FiniteElementState* state_ = nullptr;
+  /**
+   * @brief The cached evaluation points of the constrained true DOFs
+   * @note Only used for essential (Dirichlet) BCs
+   */
+  mutable std::optional<DofEvaluationPoints> dof_evaluation_points_;
   /**
    * @brief The eliminated entries for Dirichlet BCs
    */
@@ -16,6 +16,7 @@
 #include <set>
 
 #include "serac/physics/boundary_conditions/boundary_condition.hpp"
+#include "serac/physics/boundary_conditions/elimination_pattern.hpp"
 #include "serac/physics/state/finite_element_state.hpp"
 
 namespace serac {
@@ -236,6 +237,19 @@ public:
     return std::unique_ptr<mfem::HypreParMatrix>(matrix.EliminateRowsCols(allEssentialDofs()));
   }
 
+  /**
+   * @brief Eliminates all essential BCs from a matrix that is reassembled with the same sparsity, reusing the
+   * positions of the eliminated entries located by earlier eliminations
+   * @param[inout] matrix The matrix to eliminate from, will be modified
+   * @param[inout] pattern The elimination positions of the matrix, which are located again if the matrix sparsity
+   * or the set of essential DOFs has changed
+   * @note The eliminated column couplings are kept by the pattern, see EliminationPattern::eliminateToRHS
+   */
+  void eliminateAllEssentialDofsFromMatrix(mfem::HypreParMatrix& matrix, EliminationPattern& pattern) const
+  {
+    pattern.eliminate(matrix, allEssentialDofs());
+  }
+
   /**
    * @brief Sets the time for all stored boundary conditions
    *
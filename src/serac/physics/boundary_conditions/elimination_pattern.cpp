@@ -0,0 +1,195 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include "serac/physics/boundary_conditions/elimination_pattern.hpp"
+
+#include <algorithm>
+
+#include "serac/infrastructure/logger.hpp"
+
+namespace serac {
+
+void EliminationPattern::eliminate(mfem::HypreParMatrix& matrix, const mfem::Array<int>& essential_dofs)
+{
+  hypre_ParCSRMatrix* parcsr = matrix;
+
+  // the positions are located collectively, so every rank rebuilds if any of them has to
+  int rebuild = matches(parcsr, essential_dofs) ? 0 : 1;
+  MPI_Allreduce(MPI_IN_PLACE, &rebuild, 1, MPI_INT, MPI_MAX, matrix.GetComm());
+  if (rebuild) {
+    build(parcsr, essential_dofs);
+  }
+
+  hypre_CSRMatrix* diag      = hypre_ParCSRMatrixDiag(parcsr);
+  hypre_CSRMatrix* offd      = hypre_ParCSRMatrixOffd(parcsr);
+  HYPRE_Int*       diag_I    = hypre_CSRMatrixI(diag);
+  HYPRE_Int*       offd_I    = hypre_CSRMatrixI(offd);
+  double*          diag_data = hypre_CSRMatrixData(diag);
+  double*          offd_data = hypre_CSRMatrixData(offd);
+
+  for (auto& coupling : diag_couplings_) {
+    coupling.value               = diag_data[coupling.position];
+    diag_data[coupling.position] = 0.0;
+  }
+  for (auto& coupling : offd_couplings_) {
+    coupling.value               = offd_data[coupling.position];
+    offd_data[coupling.position] = 0.0;
+  }
+
+  for (int i = 0; i < essential_dofs_.Size(); i++) {
+    const int row = essential_dofs_[i];
+    std::fill(diag_data + diag_I[row], diag_data + diag_I[row + 1], 0.0);
+    std::fill(offd_data + offd_I[row], offd_data + offd_I[row + 1], 0.0);
+    diag_data[diagonal_positions_[static_cast<std::size_t>(i)]] = 1.0;
+  }
+}
+
+void EliminationPattern::eliminateToRHS(const mfem::Vector& x, mfem::Vector& rhs) const
+{
+  SLIC_ERROR_ROOT_IF(num_rows_ < 0, "Must eliminate from the matrix with eliminate before applying to RHS.");
+
+  const double* x_data   = x.HostRead();
+  double*       rhs_data = rhs.HostReadWrite();
+
+  // every rank takes part in the exchange, as its neighbors may couple to its constrained DOFs
+  exchange(x_data, offd_buffer_.data());
+
+  for (const auto& coupling : diag_couplings_) {
+    rhs_data[coupling.row] -= coupling.value * x_data[coupling.col];
+  }
+  for (const auto& coupling : offd_couplings_) {
+    rhs_data[coupling.row] -= coupling.value * offd_buffer_[static_cast<std::size_t>(coupling.col)];
+  }
+
+  for (int dof : essential_dofs_) {
+    rhs_data[dof] = x_data[dof];
+  }
+}
+
+bool EliminationPattern::matches(hypre_ParCSRMatrix* matrix, const mfem::Array<int>& essential_dofs) const
+{
+  hypre_CSRMatrix* diag = hypre_ParCSRMatrixDiag(matrix);
+  hypre_CSRMatrix* offd = hypre_ParCSRMatrixOffd(matrix);
+
+  const HYPRE_Int num_rows = hypre_CSRMatrixNumRows(diag);
+  if (num_rows != num_rows_ || hypre_CSRMatrixI(diag)[num_rows] != static_cast<HYPRE_Int>(diag_J_.size()) ||
+      hypre_CSRMatrixI(offd)[num_rows] != static_cast<HYPRE_Int>(offd_J_.size()) ||
+      static_cast<std::size_t>(hypre_CSRMatrixNumCols(offd)) != col_map_offd_.size()) {
+    return false;
+  }
+
+  if (essential_dofs.Size() != essential_dofs_.Size() ||
+      !std::equal(essential_dofs.begin(), essential_dofs.end(), essential_dofs_.begin())) {
+    return false;
+  }
+
+  // the cached positions depend on the order of the entries within each row, so the whole pattern is compared
+  return std::equal(diag_I_.begin(), diag_I_.end(), hypre_CSRMatrixI(diag)) &&
+         std::equal(diag_J_.begin(), diag_J_.end(), hypre_CSRMatrixJ(diag)) &&
+         std::equal(offd_I_.begin(), offd_I_.end(), hypre_CSRMatrixI(offd)) &&
+         std::equal(offd_J_.begin(), offd_J_.end(), hypre_CSRMatrixJ(offd)) &&
+         std::equal(col_map_offd_.begin(), col_map_offd_.end(), hypre_ParCSRMatrixColMapOffd(matrix));
+}
+
+void EliminationPattern::build(hypre_ParCSRMatrix* matrix, const mfem::Array<int>& essential_dofs)
+{
+  comm_ = hypre_ParCSRMatrixComm(matrix);
+  essential_dofs.Copy(essential_dofs_);
+
+  hypre_CSRMatrix* diag   = hypre_ParCSRMatrixDiag(matrix);
+  hypre_CSRMatrix* offd   = hypre_ParCSRMatrixOffd(matrix);
+  HYPRE_Int*       diag_I = hypre_CSRMatrixI(diag);
+  HYPRE_Int*       diag_J = hypre_CSRMatrixJ(diag);
+  HYPRE_Int*       offd_I = hypre_CSRMatrixI(offd);
+  HYPRE_Int*       offd_J = hypre_CSRMatrixJ(offd);
+
+  num_rows_ = hypre_CSRMatrixNumRows(diag);
+  diag_I_.assign(diag_I, diag_I + num_rows_ + 1);
+  diag_J_.assign(diag_J, diag_J + diag_I[num_rows_]);
+  offd_I_.assign(offd_I, offd_I + num_rows_ + 1);
+  offd_J_.assign(offd_J, offd_J + offd_I[num_rows_]);
+
+  const HYPRE_Int num_offd_cols = hypre_CSRMatrixNumCols(offd);
+  col_map_offd_.assign(hypre_ParCSRMatrixColMapOffd(matrix), hypre_ParCSRMatrixColMapOffd(matrix) + num_offd_cols);
+
+  // The constrained off-processor columns are found with hypre's communication pattern for products with this matrix
+  if (!hypre_ParCSRMatrixCommPkg(matrix)) {
+    hypre_MatvecCommPkgCreate(matrix);
+  }
+  hypre_ParCSRCommPkg* comm_pkg = hypre_ParCSRMatrixCommPkg(matrix);
+
+  const int num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+  const int num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+  send_procs_.assign(hypre_ParCSRCommPkgSendProcs(comm_pkg), hypre_ParCSRCommPkgSendProcs(comm_pkg) + num_sends);
+  send_starts_.assign(hypre_ParCSRCommPkgSendMapStarts(comm_pkg),
+                      hypre_ParCSRCommPkgSendMapStarts(comm_pkg) + num_sends + 1);
+  send_indices_.assign(hypre_ParCSRCommPkgSendMapElmts(comm_pkg),
+                       hypre_ParCSRCommPkgSendMapElmts(comm_pkg) + send_starts_.back());
+  recv_procs_.assign(hypre_ParCSRCommPkgRecvProcs(comm_pkg), hypre_ParCSRCommPkgRecvProcs(comm_pkg) + num_recvs);
+  recv_starts_.assign(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg),
+                      hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) + num_recvs + 1);
+
+  send_buffer_.resize(send_indices_.size());
+  offd_buffer_.resize(static_cast<std::size_t>(num_offd_cols));
+  requests_.resize(static_cast<std::size_t>(num_sends + num_recvs));
+
+  std::vector<double> constrained(static_cast<std::size_t>(num_rows_), 0.0);
+  for (int dof : essential_dofs_) {
+    constrained[static_cast<std::size_t>(dof)] = 1.0;
+  }
+  exchange(constrained.data(), offd_buffer_.data());
+
+  diagonal_positions_.clear();
+  for (int dof : essential_dofs_) {
+    const HYPRE_Int* row_begin = diag_J + diag_I[dof];
+    const HYPRE_Int* row_end   = diag_J + diag_I[dof + 1];
+    const HYPRE_Int* diagonal  = std::find(row_begin, row_end, dof);
+    SLIC_ERROR_IF(diagonal == row_end, "Essential DOF " << dof << " has no diagonal entry in the matrix to eliminate");
+    diagonal_positions_.push_back(static_cast<HYPRE_Int>(diagonal - diag_J));
+  }
+
+  diag_couplings_.clear();
+  offd_couplings_.clear();
+  for (HYPRE_Int row = 0; row < num_rows_; row++) {
+    if (constrained[static_cast<std::size_t>(row)] != 0.0) {
+      continue;
+    }
+    for (HYPRE_Int k = diag_I[row]; k < diag_I[row + 1]; k++) {
+      if (constrained[static_cast<std::size_t>(diag_J[k])] != 0.0) {
+        diag_couplings_.push_back({k, row, diag_J[k], 0.0});
+      }
+    }
+    for (HYPRE_Int k = offd_I[row]; k < offd_I[row + 1]; k++) {
+      if (offd_buffer_[static_cast<std::size_t>(offd_J[k])] != 0.0) {
+        offd_couplings_.push_back({k, row, offd_J[k], 0.0});
+      }
+    }
+  }
+}
+
+void EliminationPattern::exchange(const double* owned, double* offd) const
+{
+  constexpr int halo_tag = 0;
+
+  std::size_t request = 0;
+  for (std::size_t p = 0; p < recv_procs_.size(); p++) {
+    MPI_Irecv(offd + recv_starts_[p], recv_starts_[p + 1] - recv_starts_[p], MPI_DOUBLE, recv_procs_[p], halo_tag,
+              comm_, &requests_[request++]);
+  }
+  for (std::size_t k = 0; k < send_indices_.size(); k++) {
+    send_buffer_[k] = owned[send_indices_[k]];
+  }
+  for (std::size_t p = 0; p < send_procs_.size(); p++) {
+    MPI_Isend(send_buffer_.data() + send_starts_[p], send_starts_[p + 1] - send_starts_[p], MPI_DOUBLE,
+              send_procs_[p], halo_tag, comm_, &requests_[request++]);
+  }
+
+  if (!requests_.empty()) {
+    MPI_Waitall(static_cast<int>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE);
+  }
+}
+
+}  // namespace serac
@@ -0,0 +1,132 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+/**
+ * @file elimination_pattern.hpp
+ *
+ * @brief This file contains the declaration of a reusable elimination of essential DOFs from reassembled matrices
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mfem.hpp"
+
+namespace serac {
+
+/**
+ * @brief Eliminates a set of essential DOFs from the rows and columns of a HypreParMatrix in place
+ *
+ * The result is the same as HypreParMatrix::EliminateRowsCols: the constrained rows and columns are zeroed and the
+ * diagonal entries of the constrained rows are set to one. However, the CSR positions of the constrained rows, their
+ * diagonal entries, and the entries of the unconstrained rows that couple to constrained columns (including columns
+ * owned by other ranks) are located only once, when the set of essential DOFs or the sparsity of the matrix changes.
+ * The sparsity is compared exactly, including the order of the entries within each row.
+ * Every later elimination from a reassembled matrix with the same sparsity is a pass over those positions, which keeps
+ * the matrix structure unchanged and allocates no eliminated-entries matrix. The values of the column couplings are
+ * kept for the right hand side correction of non-homogeneous essential conditions.
+ */
+class EliminationPattern {
+public:
+  /**
+   * @brief Eliminates the essential DOFs from a matrix, locating their entries first if the essential DOFs or the
+   * sparsity of the matrix have changed since the last elimination
+   *
+   * @param[inout] matrix The square matrix to eliminate from, will be modified
+   * @param[in] essential_dofs The local true DOF indices to eliminate, sorted and without duplicates
+   */
+  void eliminate(mfem::HypreParMatrix& matrix, const mfem::Array<int>& essential_dofs);
+
+  /**
+   * @brief Moves the eliminated column couplings of the essential values to a right hand side
+   *
+   * Equivalent to mfem::EliminateBC with the eliminated entries of EliminateRowsCols: rhs -= A_e x on the unconstrained
+   * rows, and rhs = x on the constrained ones
+   *
+   * @param[in] x The vector holding the essential values in its constrained entries
+   * @param[inout] rhs The right hand side to correct
+   * @pre eliminate() has been called with the matrix of the linear system
+   */
+  void eliminateToRHS(const mfem::Vector& x, mfem::Vector& rhs) const;
+
+private:
+  /**
+   * @brief Whether the located positions are still valid for a matrix and set of essential DOFs
+   */
+  bool matches(hypre_ParCSRMatrix* matrix, const mfem::Array<int>& essential_dofs) const;
+
+  /**
+   * @brief Locates the entries to eliminate
+   */
+  void build(hypre_ParCSRMatrix* matrix, const mfem::Array<int>& essential_dofs);
+
+  /**
+   * @brief Exchanges the owned entries of a vector for the off-processor columns of the matrix
+   */
+  void exchange(const double* owned, double* offd) const;
+
+  /// @brief The MPI communicator of the matrix
+  MPI_Comm comm_ = MPI_COMM_NULL;
+
+  /// @brief The essential DOFs the positions were located for
+  mfem::Array<int> essential_dofs_;
+
+  /// @brief The number of local rows
+  HYPRE_Int num_rows_ = -1;
+
+  /// @brief The row offsets and column indices of the diagonal block the positions were located in
+  std::vector<HYPRE_Int> diag_I_, diag_J_;
+
+  /// @brief The row offsets and column indices of the off-diagonal block the positions were located in
+  std::vector<HYPRE_Int> offd_I_, offd_J_;
+
+  /// @brief The global indices of the off-processor columns
+  std::vector<HYPRE_BigInt> col_map_offd_;
+
+  /// @brief The diagonal block positions of the diagonal entries of the constrained rows
+  std::vector<HYPRE_Int> diagonal_positions_;
+
+  /**
+   * @brief An entry of an unconstrained row in a constrained column
+   */
+  struct Coupling {
+    /// @brief The position of the entry in its CSR block
+    HYPRE_Int position;
+
+    /// @brief The local row of the entry
+    HYPRE_Int row;
+
+    /// @brief The column of the entry in its CSR block
+    HYPRE_Int col;
+
+    /// @brief The eliminated value of the entry
+    double value;
+  };
+
+  /// @brief The column couplings in the diagonal block
+  std::vector<Coupling> diag_couplings_;
+
+  /// @brief The column couplings in the off-diagonal block, to constrained DOFs owned by other ranks
+  std::vector<Coupling> offd_couplings_;
+
+  /// @brief The ranks that local entries are sent to, and the offsets of their entries
+  std::vector<int> send_procs_, send_starts_;
+
+  /// @brief The local indices of the entries that are sent
+  std::vector<int> send_indices_;
+
+  /// @brief The ranks that off-processor entries are received from, and their offsets
+  std::vector<int> recv_procs_, recv_starts_;
+
+  /// @brief Communication buffers, the received buffer is ordered by the off-processor columns of the matrix
+  mutable std::vector<double> send_buffer_, offd_buffer_;
+
+  /// @brief The pending sends and receives
+  mutable std::vector<MPI_Request> requests_;
+};
+
+}  // namespace serac
@@ -6,6 +6,8 @@
 
 #include "serac/physics/boundary_conditions/boundary_condition_manager.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -86,6 +88,231 @@ TEST(boundary_cond, filter_generics)
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
+TEST(boundary_cond, cached_dof_projection)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+  constexpr int N    = 8;
+  auto          mesh = mfem::Mesh::MakeCartesian2D(N, N, mfem::Element::QUADRILATERAL);
+  mfem::ParMesh par_mesh(MPI_COMM_WORLD, mesh);
+  FiniteElementState state(par_mesh, FiniteElementState::Options{.order = 2, .vector_dim = 2, .name = "displ"});
+  // Explicitly allocate the gridfunction as it is not being managed by Sidre
+  state.gridFunc().GetMemory().New(state.gridFunc().Size());
+  state.gridFunc() = 0.0;
+
+  auto coef = std::make_shared<mfem::VectorFunctionCoefficient>(
+      2, [](const mfem::Vector& x, double t, mfem::Vector& u) {
+        u(0) = x(0) * x(1) + t;
+        u(1) = std::sin(x(0)) * t * t;
+      });
+  auto rate = std::make_shared<mfem::VectorFunctionCoefficient>(
+      2, [](const mfem::Vector& x, double t, mfem::Vector& u) {
+        u(0) = 1.0;
+        u(1) = 2.0 * std::sin(x(0)) * t;
+      });
+
+  BoundaryConditionManager bcs(par_mesh);
+  bcs.addEssential({1, 2}, coef, state);
+  auto& bc = bcs.essentials().front();
+  bc.setTimeDerivatives(rate);
+
+  // the projection over every boundary element is the reference
+  constexpr double t = 0.5;
+  bc.projectBdr(state, t);
+
+  mfem::Vector values(state.space().GetTrueVSize());
+  values = 0.0;
+  bc.projectBdrToDofs(values, t);
+  for (int i : bc.getTrueDofs()) {
+    EXPECT_NEAR(values[i], state.trueVec()[i], 1.0e-12);
+  }
+
+  // the analytic time derivative agrees with a finite difference of the cached projection
+  constexpr double epsilon = 1.0e-6;
+  mfem::Vector     rate_values(values.Size()), values_minus(values.Size()), values_plus(values.Size());
+  bc.projectBdrTimeDerivativeToDofs(rate_values, t, 1);
+  bc.projectBdrToDofs(values_minus, t - epsilon);
+  bc.projectBdrToDofs(values_plus, t + epsilon);
+  for (int i : bc.getTrueDofs()) {
+    EXPECT_NEAR(rate_values[i], (values_plus[i] - values_minus[i]) / (2.0 * epsilon), 1.0e-6);
+  }
+
+  EXPECT_TRUE(bc.hasTimeDerivative(1));
+  EXPECT_FALSE(bc.hasTimeDerivative(2));
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST(boundary_cond, cached_dof_projection_across_ranks)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+  int rank = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  // the boundary attribute is only on the boundary elements of every other rank, so the constrained DOFs at the
+  // ends of those boundary segments are shared with (and, depending on the ownership, owned by) ranks that have
+  // no marked boundary element touching them
+  constexpr int ATTR = 5;
+  for (int parity : {0, 1}) {
+    constexpr int N    = 8;
+    auto          mesh = mfem::Mesh::MakeCartesian2D(N, N, mfem::Element::QUADRILATERAL);
+    mfem::ParMesh par_mesh(MPI_COMM_WORLD, mesh);
+    if (rank % 2 == parity) {
+      for (int i = 0; i < par_mesh.GetNBE(); i++) {
+        par_mesh.GetBdrElement(i)->SetAttribute(ATTR);
+      }
+    }
+    par_mesh.SetAttributes();
+
+    FiniteElementState state(par_mesh, FiniteElementState::Options{.order = 2, .vector_dim = 2, .name = "displ"});
+    // Explicitly allocate the gridfunction as it is not being managed by Sidre
+    state.gridFunc().GetMemory().New(state.gridFunc().Size());
+    state.gridFunc() = 0.0;
+
+    auto coef = std::make_shared<mfem::VectorFunctionCoefficient>(
+        2, [](const mfem::Vector& x, double t, mfem::Vector& u) {
+          u(0) = 1.0 + x(0) * x(1) + t;
+          u(1) = 2.0 + std::sin(x(0)) * t * t;
+        });
+
+    BoundaryConditionManager bcs(par_mesh);
+    bcs.addEssential({ATTR}, coef, state);
+    auto& bc = bcs.essentials().front();
+
+    // the projection over every boundary element, which sums over the shared DOFs, is the reference
+    constexpr double t = 0.5;
+    bc.projectBdr(state, t);
+
+    mfem::Vector values(state.space().GetTrueVSize());
+    values = 0.0;
+    bc.projectBdrToDofs(values, t);
+    for (int i : bc.getTrueDofs()) {
+      EXPECT_NEAR(values[i], state.trueVec()[i], 1.0e-12);
+    }
+
+    // a scalar condition on a single component takes the same path
+    auto component_coef = std::make_shared<mfem::FunctionCoefficient>(
+        [](const mfem::Vector& x, double time) { return 2.0 + std::sin(x(0)) * time * time; });
+    BoundaryCondition component_bc(component_coef, 1, std::set<int>{ATTR}, par_mesh.bdr_attributes.Max());
+    component_bc.setTrueDofs(state);
+
+    values = 0.0;
+    component_bc.projectBdrToDofs(values, t);
+    for (int i : component_bc.getTrueDofs()) {
+      EXPECT_NEAR(values[i], state.trueVec()[i], 1.0e-12);
+    }
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST(boundary_cond, nodal_function_projection)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+  constexpr int N    = 8;
+  auto          mesh = mfem::Mesh::MakeCartesian2D(N, N, mfem::Element::QUADRILATERAL);
+  mfem::ParMesh par_mesh(MPI_COMM_WORLD, mesh);
+  FiniteElementState state(par_mesh, FiniteElementState::Options{.order = 2, .vector_dim = 2, .name = "displ"});
+
+  auto displacement = [](const tensor<double, 2>& x, double t) { return tensor<double, 2>{{x[0] * x[1] + t, t * t}}; };
+  auto coef         = std::make_shared<mfem::VectorFunctionCoefficient>(
+      2, [displacement](const mfem::Vector& x, double t, mfem::Vector& u) {
+        auto value = displacement(tensor<double, 2>{{x[0], x[1]}}, t);
+        u(0)       = value[0];
+        u(1)       = value[1];
+      });
+
+  BoundaryConditionManager bcs(par_mesh);
+  bcs.addEssential({1, 2}, coef, state);
+  bcs.addEssential({3}, coef, state);
+  bcs.essentials().back().setNodalFunction<2>(displacement);
+
+  // the nodal function and the coefficient agree at every constrained true DOF
+  constexpr double t = 0.5;
+  mfem::Vector     values(state.space().GetTrueVSize()), reference(state.space().GetTrueVSize());
+  values    = 0.0;
+  reference = 0.0;
+  for (auto& bc : bcs.essentials()) {
+    bc.projectBdrToDofs(values, t);
+  }
+  BoundaryCondition without_function(coef, {}, std::set<int>{3}, par_mesh.bdr_attributes.Max());
+  without_function.setTrueDofs(state);
+  bcs.essentials().front().projectBdrToDofs(reference, t);
+  without_function.projectBdrToDofs(reference, t);
+
+  for (int i : bcs.allEssentialDofs()) {
+    EXPECT_NEAR(values[i], reference[i], 1.0e-12);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST(boundary_cond, cached_elimination_pattern)
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+  constexpr int N    = 8;
+  auto          mesh = mfem::Mesh::MakeCartesian2D(N, N, mfem::Element::QUADRILATERAL);
+  mfem::ParMesh par_mesh(MPI_COMM_WORLD, mesh);
+  FiniteElementState state(par_mesh);
+
+  BoundaryConditionManager bcs(par_mesh);
+  auto                     coef = std::make_shared<mfem::ConstantCoefficient>(1);
+  bcs.addEssential({1, 4}, coef, state);
+
+  // a convection term makes the matrix nonsymmetric, so the row and column eliminations differ
+  mfem::Vector velocity(2);
+  velocity(0) = 1.0;
+  velocity(1) = 0.5;
+  mfem::VectorConstantCoefficient velocity_coef(velocity);
+  mfem::ParBilinearForm           form(&state.space());
+  form.AddDomainIntegrator(new mfem::DiffusionIntegrator());
+  form.AddDomainIntegrator(new mfem::ConvectionIntegrator(velocity_coef));
+  form.Assemble();
+  form.Finalize();
+
+  mfem::Vector x(state.space().GetTrueVSize());
+  mfem::Vector y(x.Size()), y_reference(x.Size());
+  x.Randomize(1);
+
+  // the second elimination reuses the located positions for a reassembled matrix with new values. The third one
+  // stores the same matrix with the off-diagonal entries of each row in reverse order, which keeps the number of
+  // rows and entries but moves the positions, so they have to be located again
+  EliminationPattern pattern;
+  for (double scale : {1.0, 2.0, 3.0}) {
+    std::unique_ptr<mfem::HypreParMatrix> A(form.ParallelAssemble());
+    std::unique_ptr<mfem::HypreParMatrix> A_reference(form.ParallelAssemble());
+    *A *= scale;
+    *A_reference *= scale;
+
+    if (scale == 3.0) {
+      hypre_CSRMatrix* diag   = hypre_ParCSRMatrixDiag(static_cast<hypre_ParCSRMatrix*>(*A));
+      HYPRE_Int*       diag_I = hypre_CSRMatrixI(diag);
+      HYPRE_Int*       diag_J = hypre_CSRMatrixJ(diag);
+      double*          data   = hypre_CSRMatrixData(diag);
+      for (int row = 0; row < hypre_CSRMatrixNumRows(diag); row++) {
+        // hypre keeps the diagonal entry first
+        std::reverse(diag_J + diag_I[row] + 1, diag_J + diag_I[row + 1]);
+        std::reverse(data + diag_I[row] + 1, data + diag_I[row + 1]);
+      }
+    }
+
+    bcs.eliminateAllEssentialDofsFromMatrix(*A, pattern);
+    auto A_e = bcs.eliminateAllEssentialDofsFromMatrix(*A_reference);
+
+    A->Mult(x, y);
+    A_reference->Mult(x, y_reference);
+    for (int i = 0; i < x.Size(); i++) {
+      EXPECT_NEAR(y[i], y_reference[i], 1.0e-12);
+    }
+
+    mfem::Vector rhs(x.Size()), rhs_reference(x.Size());
+    rhs           = 1.0;
+    rhs_reference = 1.0;
+    pattern.eliminateToRHS(x, rhs);
+    mfem::EliminateBC(*A_reference, *A_e, bcs.allEssentialDofs(), x, rhs_reference);
+    for (int i = 0; i < x.Size(); i++) {
+      EXPECT_NEAR(rhs[i], rhs_reference[i], 1.0e-12);
+    }
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
 }  // namespace serac
 
 //------------------------------------------------------------------------------
@@ -217,12 +217,19 @@ struct ConstantTraction {
   }
 };
 
-/// Function-based traction boundary condition model
-template <int dim>
+/**
+ * @brief Function-based traction boundary condition model
+ *
+ * @tparam dim Spatial dimension
+ * @tparam TractionFunc The type of the traction function. The std::function default accepts any callable, but it costs
+ * an indirect call at every boundary quadrature point; makeTractionFunction keeps the concrete type of the callable
+ * so that the boundary kernel can inline it.
+ */
+template <int dim, typename TractionFunc = std::function<tensor<double, dim>(
+                       const tensor<double, dim>&, const tensor<double, dim>&, const double)>>
 struct TractionFunction {
   /// The traction function
-  std::function<tensor<double, dim>(const tensor<double, dim>&, const tensor<double, dim>&, const double)>
-      traction_func_;
+  TractionFunc traction_func_;
 
   /**
    * @brief Evaluation for the function-based traction model
@@ -239,6 +246,20 @@ struct TractionFunction {
   }
 };
 
+/**
+ * @brief Creates a function-based traction model that stores the concrete type of the traction function
+ *
+ * @tparam dim Spatial dimension
+ * @tparam TractionFunc The type of the traction function
+ * @param traction_func The traction as a function of the spatial coordinate, the normal vector and the time
+ * @return The traction model
+ */
+template <int dim, typename TractionFunc>
+TractionFunction<dim, TractionFunc> makeTractionFunction(TractionFunc traction_func)
+{
+  return {traction_func};
+}
+
 /// Constant pressure model
 struct ConstantPressure {
   /// The constant pressure
@@ -256,11 +277,18 @@ struct ConstantPressure {
   }
 };
 
-/// Function-based pressure boundary condition
-template <int dim>
+/**
+ * @brief Function-based pressure boundary condition
+ *
+ * @tparam dim Spatial dimension
+ * @tparam PressureFunc The type of the pressure function. The std::function default accepts any callable, but it costs
+ * an indirect call at every boundary quadrature point; makePressureFunction keeps the concrete type of the callable
+ * so that the boundary kernel can inline it.
+ */
+template <int dim, typename PressureFunc = std::function<double(const tensor<double, dim>&, const double)>>
 struct PressureFunction {
   /// The pressure function
-  std::function<double(const tensor<double, dim>&, const double)> pressure_func_;
+  PressureFunc pressure_func_;
 
   /**
    * @brief Evaluation for the function-based pressure model
@@ -275,4 +303,18 @@ struct PressureFunction {
   }
 };
 
+/**
+ * @brief Creates a function-based pressure model that stores the concrete type of the pressure function
+ *
+ * @tparam dim Spatial dimension
+ * @tparam PressureFunc The type of the pressure function
+ * @param pressure_func The pressure as a function of the spatial coordinate and the time
+ * @return The pressure model
+ */
+template <int dim, typename PressureFunc>
+PressureFunction<dim, PressureFunc> makePressureFunction(PressureFunc pressure_func)
+{
+  return {pressure_func};
+}
+
 }  // namespace serac::solid_util
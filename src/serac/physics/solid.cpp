@@ -69,6 +69,9 @@ Solid::Solid(int order, const SolverOptions& options, GeometricNonlinearities ge
   if (options.dyn_options) {
     ode2_.SetTimestepper(options.dyn_options->timestepper);
     ode2_.SetEnforcementMethod(options.dyn_options->enforcement_method);
+    if (options.dyn_options->adaptivity) {
+      ode2_.SetAdaptivity(*options.dyn_options->adaptivity, mesh_.GetComm());
+    }
     is_quasistatic_ = false;
   } else {
     is_quasistatic_ = true;
@@ -348,7 +351,7 @@ void Solid::completeSetup()
           auto localJ = std::unique_ptr<mfem::SparseMatrix>(Add(1.0, M_->SpMat(), c1_, C_->SpMat()));
           localJ->Add(c0_, H_->GetLocalGradient(u_ + c0_ * d2u_dt2));
           J_mat_.reset(M_->ParallelAssemble(localJ.get()));
-          bcs_.eliminateAllEssentialDofsFromMatrix(*J_mat_);
+          bcs_.eliminateAllEssentialDofsFromMatrix(*J_mat_, J_elimination_);
           return *J_mat_;
         });
   }
@@ -375,7 +378,7 @@ std::unique_ptr<mfem::Operator> Solid::buildQuasistaticOperator()
       // gradient of residual function
       [this](const mfem::Vector& u) -> mfem::Operator& {
         auto& J = dynamic_cast<mfem::HypreParMatrix&>(H_->GetGradient(u));
-        bcs_.eliminateAllEssentialDofsFromMatrix(J);
+        bcs_.eliminateAllEssentialDofsFromMatrix(J, J_elimination_);
         return J;
       });
   return residual;
@@ -539,10 +542,8 @@ const FiniteElementState& Solid::solveAdjoint(FiniteElementDual& adjoint_load,
     adjoint_essential = dual_with_essential_boundary->trueVec();
   }
 
-  for (const auto& bc : bcs_.essentials()) {
-    bc.eliminateFromMatrix(*J_T);
-    bc.eliminateToRHS(*J_T, adjoint_essential, adjoint_load_vector);
-  }
+  bcs_.eliminateAllEssentialDofsFromMatrix(*J_T, J_T_elimination_);
+  J_T_elimination_.eliminateToRHS(adjoint_essential, adjoint_load_vector);
 
   lin_solver.SetOperator(*J_T);
   lin_solver.Mult(adjoint_load_vector, adjoint_displacement_.trueVec());
@@ -593,6 +594,9 @@ void Solid::InputOptions::defineInputFileSchema(axom::inlet::Container& containe
   auto& dynamics_container = container.addStruct("dynamics", "Parameters for mass matrix inversion");
   dynamics_container.addString("timestepper", "Timestepper (ODE) method to use");
   dynamics_container.addString("enforcement_method", "Time-varying constraint enforcement method to use");
+  auto& adaptivity_container =
+      dynamics_container.addStruct("adaptivity", "Parameters for error-controlled adaptive time stepping");
+  serac::mfem_ext::TimestepController::DefineInputFileSchema(adaptivity_container);
 
   auto& bc_container = container.addStructDictionary("boundary_conds", "Container of boundary conditions");
   serac::input::BoundaryConditionInputOptions::defineInputFileSchema(bc_container);
@@ -670,6 +674,10 @@ serac::Solid::InputOptions FromInlet<serac::Solid::InputOptions>::operator()(con
                        "Unrecognized enforcement method: " << enforcement_method);
     dyn_options.enforcement_method = enforcement_methods.at(enforcement_method);
 
+    if (dynamics.contains("adaptivity")) {
+      dyn_options.adaptivity = dynamics["adaptivity"].get<serac::AdaptiveTimestepOptions>();
+    }
+
     result.solver_options.dyn_options = std::move(dyn_options);
   }
 
@@ -84,6 +84,13 @@ public:
      *
      */
     DirichletEnforcementMethod enforcement_method;
+
+    /**
+     * @brief The parameters of error-controlled adaptive time stepping
+     * @note If this is not defined, the time steps are fixed
+     *
+     */
+    std::optional<AdaptiveTimestepOptions> adaptivity = std::nullopt;
   };
   /**
    * @brief A configuration variant for the various solves
@@ -522,6 +529,16 @@ protected:
    */
   std::unique_ptr<mfem::HypreParMatrix> J_mat_;
 
+  /**
+   * @brief Essential DOF elimination positions of the Jacobian, reused while its sparsity is unchanged
+   */
+  EliminationPattern J_elimination_;
+
+  /**
+   * @brief Essential DOF elimination positions of the transposed Jacobian of the adjoint problem
+   */
+  EliminationPattern J_T_elimination_;
+
   /**
    * @brief Mass bilinear form object
    */
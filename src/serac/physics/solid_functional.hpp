@@ -32,6 +32,16 @@ struct TimesteppingOptions {
 
   /// The essential boundary enforcement method to use
   DirichletEnforcementMethod enforcement_method;
+
+  /// The parameters of error-controlled adaptive time stepping, which is disabled if this is not defined
+  std::optional<AdaptiveTimestepOptions> adaptivity = std::nullopt;
+
+  /**
+   * @brief Whether to integrate explicitly with a row-summed lumped mass matrix
+   * @note This requires the CentralDifference timestepper. Each step is then a single residual evaluation
+   * and a diagonal scaling, and steps longer than the critical time step are subcycled.
+   */
+  bool lumped_mass = false;
 };
 
 /**
@@ -53,6 +63,9 @@ struct SolverOptions {
    * @note If this is not defined, a quasi-static solve is performed
    */
   std::optional<TimesteppingOptions> dyn_options = std::nullopt;
+
+  /// The initial guess of the nonlinear solve in each step, quasi-static or dynamic
+  PredictorType predictor = PredictorType::Previous;
 };
 }  // namespace solid_util
 
@@ -132,7 +145,12 @@ public:
     const auto& lin_options = options.H_lin_options;
     // If the user wants the AMG preconditioner with a linear solver, set the pfes
     // to be the displacement
-    const auto& augmented_options = mfem_ext::AugmentAMGForElasticity(lin_options, displacement_.space());
+    auto augmented_options = mfem_ext::AugmentAMGForElasticity(lin_options, displacement_.space());
+
+    // If the user wants an element-based preconditioner, give it access to the element gradients
+    augmented_options = mfem_ext::AugmentElementPreconditioner(
+        augmented_options, displacement_.space(), [this]() -> const mfem::SparseMatrix& { return localJacobian(); },
+        bcs_.allEssentialDofs());
 
     nonlin_solver_ = mfem_ext::EquationSolver(mesh_.GetComm(), augmented_options, options.H_nonlin_options);
 
@@ -140,14 +158,25 @@ public:
     if (options.dyn_options) {
       ode2_.SetTimestepper(options.dyn_options->timestepper);
       ode2_.SetEnforcementMethod(options.dyn_options->enforcement_method);
+      ode2_.SetPredictor(options.predictor);
+      if (options.dyn_options->adaptivity) {
+        ode2_.SetAdaptivity(*options.dyn_options->adaptivity, mesh_.GetComm());
+      }
+      lumped_mass_ = options.dyn_options->lumped_mass;
+      SLIC_ERROR_ROOT_IF(lumped_mass_ && options.dyn_options->timestepper != TimestepMethod::CentralDifference,
+                         "The lumped mass matrix is only available with the CentralDifference timestepper");
+      SLIC_ERROR_ROOT_IF(lumped_mass_ && options.dyn_options->adaptivity,
+                         "The lumped mass matrix does not support adaptive time stepping");
       is_quasistatic_ = false;
     } else {
+      predictor_.SetType(options.predictor);
       is_quasistatic_ = true;
     }
 
     int true_size = velocity_.space().TrueVSize();
 
     u_.SetSize(true_size);
+    K_arg_.SetSize(true_size);
     du_dt_.SetSize(true_size);
     previous_.SetSize(true_size);
     previous_ = 0.0;
@@ -191,6 +220,34 @@ public:
     disp_bdr_coef_ = std::make_shared<mfem::VectorFunctionCoefficient>(dim, disp);
 
     bcs_.addEssential(disp_bdr, disp_bdr_coef_, displacement_);
+    invalidateMassMatrix();
+  }
+
+  /**
+   * @brief Set the displacement essential boundary conditions from a q-function-style callable
+   *
+   * The callable is evaluated directly at the nodes of the constrained DOFs whenever the boundary values are updated
+   * during time integration, without a coefficient or an element transformation per node.
+   *
+   * @tparam Func The type of the callable, invoked as disp(tensor<double, dim> x, double t) -> tensor<double, dim>
+   * @param[in] disp_bdr The set of boundary attributes to set the displacement on
+   * @param[in] disp The callable containing the set displacement values
+   */
+  template <typename Func, typename = std::enable_if_t<std::is_invocable_v<Func, tensor<double, dim>, double>>>
+  void setDisplacementBCs(const std::set<int>& disp_bdr, Func disp)
+  {
+    // the coefficient is still used for the projections over the boundary elements
+    disp_bdr_coef_ = std::make_shared<mfem::VectorFunctionCoefficient>(
+        dim, [disp](const mfem::Vector& x, double t, mfem::Vector& u) {
+          auto value = disp(make_tensor<dim>([&x](int i) { return x[i]; }), t);
+          for (int i = 0; i < dim; i++) {
+            u[i] = value[i];
+          }
+        });
+
+    bcs_.addEssential(disp_bdr, disp_bdr_coef_, displacement_);
+    bcs_.essentials().back().setNodalFunction<dim>(disp);
+    invalidateMassMatrix();
   }
 
   /**
@@ -207,10 +264,22 @@ public:
     component_disp_bdr_coef_ = std::make_shared<mfem::FunctionCoefficient>(disp);
 
     bcs_.addEssential(disp_bdr, component_disp_bdr_coef_, displacement_, component);
+    invalidateMassMatrix();
   }
 
-  /// @brief Solve the Quasi-static Newton system
-  void quasiStaticSolve() { nonlin_solver_.Mult(zero_, displacement_.trueVec()); }
+  /// @brief Solve the Quasi-static Newton system, starting from the predicted displacement
+  void quasiStaticSolve()
+  {
+    auto& u = displacement_.trueVec();
+
+    predictor_.Extrapolate(time_, u);
+    if (predictor_.Type() == PredictorType::Tangent) {
+      nonlin_solver_.PredictWithLastJacobian(zero_, u);
+    }
+
+    nonlin_solver_.Mult(zero_, u);
+    predictor_.Record(time_, u);
+  }
 
   /**
    * @brief Advance the timestep
@@ -236,6 +305,13 @@ public:
       quasiStaticSolve();
       // Update the time for housekeeping purposes
       time_ += dt;
+    } else if (lumped_mass_) {
+      // subcycle steps that exceed the (safety-factored) critical time step
+      const int    substeps = std::max(1, static_cast<int>(std::ceil(dt / (critical_dt_safety * critical_dt_))));
+      const double substep  = dt / substeps;
+      for (int i = 0; i < substeps; i++) {
+        explicitStep(substep);
+      }
     } else {
       ode2_.Step(displacement_.trueVec(), velocity_.trueVec(), time_, dt);
     }
@@ -311,8 +387,17 @@ public:
           return serac::tuple{source, flux};
         },
         mesh_);
+
+    invalidateMassMatrix();
   }
 
+  /**
+   * @brief Discard the cached mass matrix of implicit dynamics, so it is reassembled by the next Jacobian evaluation
+   * @note Changes of the parameter fields are detected automatically, but this must be called after the reference
+   * geometry of the mesh changes
+   */
+  void invalidateMassMatrix() { M_local_ = nullptr; }
+
   /**
    * @brief Set the underlying finite element state to a prescribed displacement
    *
@@ -323,7 +408,8 @@ public:
     // Project the coefficient onto the grid function
     mfem::VectorFunctionCoefficient disp_coef(dim, disp);
     displacement_.project(disp_coef);
-    gf_initialized_[1] = true;
+    gf_initialized_[1]  = true;
+    acceleration_valid_ = false;
   }
 
   /**
@@ -479,6 +565,9 @@ public:
     displacement_.initializeTrueVec();
 
     mesh_.NewNodes(*reference_nodes_);
+
+    predictor_.Reset();
+    acceleration_valid_ = false;
   }
 
   /// @brief Build the quasi-static operator corresponding to the total Lagrangian formulation
@@ -503,13 +592,49 @@ public:
 
           auto [r, drdu] = (*K_functional_)(functional_call_args_, Index<0>{});
           J_             = assemble(drdu);
-          bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+          J_local_       = &drdu.localMatrix();
+          bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
           return *J_;
         });
 
     return residual;
   }
 
+  /**
+   * @brief The processor-local Jacobian, summed directly from the most recently computed element gradients
+   * @note This is used by element-based preconditioners, which avoid global assembly
+   */
+  const mfem::SparseMatrix& localJacobian()
+  {
+    SLIC_ERROR_ROOT_IF(!J_local_, "The Jacobian must be evaluated before its processor-local part is available");
+    return *J_local_;
+  }
+
+  /**
+   * @brief Estimate the critical time step of the explicit central difference method with the lumped mass matrix
+   *
+   * The largest eigenvalue of M_lumped^-1 K, whose square root is the highest frequency of the discretization, is
+   * bounded by the Gerschgorin row sums of the tangent stiffness at the current displacement, which gives a
+   * conservative stable step 2 / sqrt(lambda_max) without requiring the wave speed of the material.
+   *
+   * @return The critical time step
+   * @pre The lumped mass matrix must be enabled in the timestepping options, and completeSetup() must be called
+   */
+  double criticalTimestep()
+  {
+    SLIC_ERROR_ROOT_IF(!lumped_mass_ || inv_lumped_mass_.Size() == 0,
+                       "The critical time step is only available for explicit dynamics with a lumped mass matrix");
+
+    functional_call_args_[0] = displacement_.trueVec();
+    auto [r, drdu]           = (*K_functional_)(functional_call_args_, Index<0>{});
+    std::unique_ptr<mfem::HypreParMatrix> K(assemble(drdu));
+
+    const double lambda_max = mfem_ext::LumpedSpectralRadiusBound(*K, inv_lumped_mass_, bcs_.allEssentialDofs());
+
+    SLIC_ERROR_ROOT_IF(lambda_max <= 0.0, "Unable to estimate the critical time step from a vanishing stiffness");
+    return 2.0 / std::sqrt(lambda_max);
+  }
+
   /**
    * @brief Complete the initialization and allocation of the data structures.
    *
@@ -530,6 +655,11 @@ public:
 
     if (is_quasistatic_) {
       residual_ = buildQuasistaticOperator();
+    } else if (lumped_mass_) {
+      computeLumpedMass();
+      critical_dt_ = criticalTimestep();
+      // explicit steps need no nonlinear solve, the stiffness operator is kept for solveAdjoint
+      residual_ = buildQuasistaticOperator();
     } else {
       // the dynamic case is described by a residual function and a second order
       // ordinary differential equation. Here, we define the residual function in
@@ -540,13 +670,12 @@ public:
           [this](const mfem::Vector& d2u_dt2, mfem::Vector& r) {
             functional_call_args_[0] = d2u_dt2;
 
-            auto M_residual = (*M_functional_)(functional_call_args_);
+            const mfem::Vector& M_residual = (*M_functional_)(functional_call_args_);
 
-            mfem::Vector K_arg(u_.Size());
-            add(1.0, u_, c0_, d2u_dt2, K_arg);
-            functional_call_args_[0] = K_arg;
+            add(1.0, u_, c0_, d2u_dt2, K_arg_);
+            functional_call_args_[0] = K_arg_;
 
-            auto K_residual = (*K_functional_)(functional_call_args_);
+            const mfem::Vector& K_residual = (*K_functional_)(functional_call_args_);
 
             functional_call_args_[0] = u_;
 
@@ -555,24 +684,20 @@ public:
           },
 
           [this](const mfem::Vector& d2u_dt2) -> mfem::Operator& {
-            functional_call_args_[0] = d2u_dt2;
-
-            auto M = serac::get<1>((*M_functional_)(functional_call_args_, Index<0>{}));
-            std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
+            const mfem::SparseMatrix& M = massMatrix(d2u_dt2);
 
             // J = M + c0 * H(u_predicted)
-            mfem::Vector K_arg(u_.Size());
-            add(1.0, u_, c0_, d2u_dt2, K_arg);
-            functional_call_args_[0] = K_arg;
+            add(1.0, u_, c0_, d2u_dt2, K_arg_);
+            functional_call_args_[0] = K_arg_;
 
-            auto K = serac::get<1>((*K_functional_)(functional_call_args_, Index<0>{}));
+            auto [r, K] = (*K_functional_)(functional_call_args_, Index<0>{});
 
             functional_call_args_[0] = u_;
 
-            std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-            J_.reset(mfem::Add(1.0, *m_mat, c0_, *k_mat));
-            bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+            // the mass and stiffness gradients share a sparsity pattern, so J is summed in a single assembly
+            J_       = K.assemble(1.0, M, c0_);
+            J_local_ = &K.localMatrix();
+            bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
 
             return *J_;
           });
@@ -602,28 +727,35 @@ public:
 
     auto& lin_solver = nonlin_solver_.LinearSolver();
 
-    // By default, use a homogeneous essential boundary condition
-    mfem::HypreParVector adjoint_essential(adjoint_load.trueVec());
-    adjoint_essential = 0.0;
-
     functional_call_args_[0] = displacement_.trueVec();
 
     auto [r, drdu] = (*K_functional_)(functional_call_args_, Index<0>{});
-    auto jacobian  = assemble(drdu);
-    auto J_T       = std::unique_ptr<mfem::HypreParMatrix>(jacobian->Transpose());
 
-    // If we have a non-homogeneous essential boundary condition, extract it from the given state
+    // The transposed Jacobian is applied matrix-free by the element kernels, with the essential DOFs constrained
+    mfem::TransposeOperator   drdu_T(drdu);
+    mfem::ConstrainedOperator J_T(&drdu_T, bcs_.allEssentialDofs());
+
+    // If we have a non-homogeneous essential boundary condition, extract it from the given state, otherwise
+    // use a homogeneous one
     if (dual_with_essential_boundary) {
       dual_with_essential_boundary->initializeTrueVec();
-      adjoint_essential = dual_with_essential_boundary->trueVec();
+      J_T.EliminateRHS(dual_with_essential_boundary->trueVec(), adjoint_load_vector);
+    } else {
+      adjoint_load_vector.SetSubVector(bcs_.allEssentialDofs(), 0.0);
     }
 
-    for (const auto& bc : bcs_.essentials()) {
-      bc.eliminateFromMatrix(*J_T);
-      bc.eliminateToRHS(*J_T, adjoint_essential, adjoint_load_vector);
+    // The preconditioner is built from the assembled Jacobian, which approximates its transpose
+    J_       = assemble(drdu);
+    J_local_ = &drdu.localMatrix();
+    bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
+
+    // Only direct solvers need the transposed matrix, which is the transpose of the eliminated Jacobian
+    std::unique_ptr<mfem::HypreParMatrix> J_T_matrix;
+    if (!nonlin_solver_.SetLinearOperator(J_T, *J_)) {
+      J_T_matrix.reset(J_->Transpose());
+      lin_solver.SetOperator(*J_T_matrix);
     }
 
-    lin_solver.SetOperator(*J_T);
     lin_solver.Mult(adjoint_load_vector, adjoint_displacement_.trueVec());
 
     adjoint_displacement_.distributeSharedDofs();
@@ -650,9 +782,8 @@ public:
 
     auto [r, drdparam] = (*K_functional_)(functional_call_args_, Index<parameter_field + 1>{});
 
-    auto drdparam_mat = assemble(drdparam);
-
-    drdparam_mat->MultTranspose(adjoint_displacement_.trueVec(), parameter_sensitivities_[parameter_field]->trueVec());
+    // the vector-Jacobian product is computed by the element kernels, without assembling the rectangular dR/dparameter
+    drdparam.MultTranspose(adjoint_displacement_.trueVec(), parameter_sensitivities_[parameter_field]->trueVec());
 
     parameter_sensitivities_[parameter_field]->distributeSharedDofs();
 
@@ -660,6 +791,116 @@ public:
   }
 
 protected:
+  /**
+   * @brief The processor-local mass matrix, which is cached between Jacobian evaluations
+   *
+   * The mass matrix only depends on the density and the reference geometry, so it is reassembled only when the
+   * parameter fields have changed since the last assembly or invalidateMassMatrix() was called. With geometric
+   * nonlinearities the mass term also depends on its argument, and it is reassembled at every evaluation.
+   *
+   * @param[in] d2u_dt2 The acceleration the mass term is linearized about
+   * @return The processor-local mass matrix, which shares the sparsity pattern of the residual gradient
+   */
+  const mfem::SparseMatrix& massMatrix(const mfem::Vector& d2u_dt2)
+  {
+    int changed = !M_local_ || geom_nonlin_ == GeometricNonlinearities::On;
+    for (size_t i = 0; i < sizeof...(parameter_space); ++i) {
+      const mfem::Vector& parameter = parameter_states_[i].get().trueVec();
+      changed |= (parameter.Size() != M_parameters_[i].Size()) ||
+                 !std::equal(parameter.begin(), parameter.end(), M_parameters_[i].begin());
+    }
+
+    // evaluating the mass functional is collective, so every rank reassembles if any rank has a changed parameter
+    MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_MAX, mesh_.GetComm());
+    if (!changed) {
+      return *M_local_;
+    }
+
+    functional_call_args_[0] = d2u_dt2;
+    auto [r, M]              = (*M_functional_)(functional_call_args_, Index<0>{});
+    M_local_                 = &M.assembleLocal();
+    functional_call_args_[0] = u_;
+
+    for (size_t i = 0; i < sizeof...(parameter_space); ++i) {
+      M_parameters_[i] = parameter_states_[i].get().trueVec();
+    }
+    return *M_local_;
+  }
+
+  /**
+   * @brief Compute the inverse of the row-summed lumped mass matrix
+   *
+   * The mass residual is linear in the acceleration, so its gradient at zero acceleration is the mass matrix.
+   */
+  void computeLumpedMass()
+  {
+    functional_call_args_[0] = zero_;
+    auto [r, dMdu]           = (*M_functional_)(functional_call_args_, Index<0>{});
+    mfem::Vector lumped_mass;
+    mfem_ext::LumpedMass(dMdu, mesh_.GetComm(), lumped_mass, inv_lumped_mass_);
+    functional_call_args_[0] = displacement_.trueVec();
+
+    acceleration_.SetSize(zero_.Size());
+    acceleration_valid_ = false;
+  }
+
+  /**
+   * @brief Compute the acceleration of a displacement at the current time from the lumped mass matrix,
+   * which is zero at the constrained dofs
+   * @param[in] u The displacement
+   * @param[out] a The acceleration
+   */
+  void explicitAcceleration(const mfem::Vector& u, mfem::Vector& a)
+  {
+    functional_call_args_[0] = u;
+    a                        = (*K_functional_)(functional_call_args_);
+    functional_call_args_[0] = displacement_.trueVec();
+
+    // M a + K(u) = 0
+    for (int i = 0; i < a.Size(); i++) {
+      a[i] *= -inv_lumped_mass_[i];
+    }
+    a.SetSubVector(bcs_.allEssentialDofs(), 0.0);
+  }
+
+  /**
+   * @brief Take one step of the explicit central difference method with the lumped mass matrix
+   *
+   * The constrained dofs take their boundary values at the end of the step, and their velocities are the central
+   * difference of those values.
+   *
+   * @param[in] dt The time step, which should not exceed the critical time step
+   */
+  void explicitStep(double dt)
+  {
+    auto& u = displacement_.trueVec();
+    auto& v = velocity_.trueVec();
+
+    if (!acceleration_valid_) {
+      explicitAcceleration(u, acceleration_);
+      acceleration_valid_ = true;
+    }
+
+    // half step velocity, then full step displacement
+    v.Add(0.5 * dt, acceleration_);
+    u_ = u;
+    u.Add(dt, v);
+    time_ += dt;
+
+    for (const auto& bc : bcs_.essentials()) {
+      bc.projectBdrToDofs(u, time_);
+    }
+    for (int i : bcs_.allEssentialDofs()) {
+      v[i] = (u[i] - u_[i]) / dt;
+    }
+
+    explicitAcceleration(u, acceleration_);
+    v.Add(0.5 * dt, acceleration_);
+  }
+
+  /// The fraction of the critical time step used by the explicit central difference method
+  static constexpr double critical_dt_safety = 0.9;
+
   /// The compile-time finite element trial space for displacement and velocity (H1 of order p)
   using trial = H1<order, dim>;
 
@@ -709,15 +950,48 @@ protected:
   /// Assembled sparse matrix for the Jacobian
   std::unique_ptr<mfem::HypreParMatrix> J_;
 
+  /// The essential DOF elimination positions of the Jacobian, which keeps its sparsity between Newton iterations
+  EliminationPattern J_elimination_;
+
+  /// The parameter fields the cached mass matrix was assembled with
+  std::array<mfem::Vector, sizeof...(parameter_space)> M_parameters_;
+
+  /// Processor-local mass matrix, cached between Jacobian evaluations and owned by the mass gradient
+  const mfem::SparseMatrix* M_local_ = nullptr;
+
+  /// Processor-local Jacobian of the most recent Jacobian evaluation, owned by the stiffness gradient
+  const mfem::SparseMatrix* J_local_ = nullptr;
+
+  /// @brief Whether dynamic problems are integrated explicitly with the lumped mass matrix
+  bool lumped_mass_ = false;
+
+  /// @brief The inverse of the row-summed lumped mass matrix
+  mfem::Vector inv_lumped_mass_;
+
+  /// @brief The acceleration at the current time of explicit dynamics
+  mfem::Vector acceleration_;
+
+  /// @brief Whether acceleration_ corresponds to the current displacement
+  bool acceleration_valid_ = false;
+
+  /// @brief The critical time step of explicit dynamics, estimated at setup
+  double critical_dt_ = 0.0;
+
   /// @brief used to communicate the ODE solver's predicted displacement to the residual operator
   mfem::Vector u_;
 
+  /// @brief workspace for the displacement the stiffness is evaluated at in dynamic residual and Jacobian evaluations
+  mfem::Vector K_arg_;
+
   /// @brief used to communicate the ODE solver's predicted velocity to the residual operator
   mfem::Vector du_dt_;
 
   /// @brief the previous acceleration, used as a starting guess for newton's method
   mfem::Vector previous_;
 
+  /// @brief Predicts the starting guess of quasi-static solves from the previous displacements
+  mfem_ext::SolutionPredictor predictor_;
+
   /// @brief Current time step
   double c0_;
 
@@ -0,0 +1,238 @@
+// Copyright (c) 2019-2022, Lawrence Livermore National Security, LLC and
+// other Serac Project Developers. See the top-level LICENSE file for
+// details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+
+#include <cstdlib>
+#include <new>
+
+#include <gtest/gtest.h>
+#include "mfem.hpp"
+
+#include "serac/serac_config.hpp"
+#include "serac/mesh/mesh_utils.hpp"
+#include "serac/physics/state/state_manager.hpp"
+#include "serac/physics/solid_functional.hpp"
+#include "serac/physics/thermal_conduction_functional.hpp"
+#include "serac/physics/materials/solid_functional_material.hpp"
+#include "serac/physics/materials/thermal_functional_material.hpp"
+#include "serac/physics/materials/parameterized_thermal_functional_material.hpp"
+
+namespace {
+
+/// @brief Whether heap allocations are currently being counted
+bool counting_allocations = false;
+
+/// @brief The number of heap allocations since counting was enabled
+std::size_t num_allocations = 0;
+
+/// @brief The number of bytes allocated on the heap since counting was enabled
+std::size_t num_allocated_bytes = 0;
+
+}  // namespace
+
+// the replaceable global allocation functions count every heap allocation of this executable,
+// the array forms forward to these by default
+void* operator new(std::size_t size)
+{
+  if (counting_allocations) {
+    num_allocations++;
+    num_allocated_bytes += size;
+  }
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace serac {
+
+/**
+ * @brief Counts the heap allocations of repeated residual evaluations, after a first one has set up any workspaces
+ */
+std::size_t residual_allocations(mfem::Operator& residual)
+{
+  mfem::Vector x(residual.Width());
+  mfem::Vector r(residual.Height());
+  x.Randomize(1);
+
+  residual.Mult(x, r);
+
+  num_allocations      = 0;
+  counting_allocations = true;
+  for (int i = 0; i < 3; i++) {
+    residual.Mult(x, r);
+  }
+  counting_allocations = false;
+
+  return num_allocations;
+}
+
+/// @brief Exposes the residual operator that the Newton solver of SolidFunctional evaluates
+template <int p, int dim>
+class SolidFunctionalResidual : public SolidFunctional<p, dim> {
+public:
+  using SolidFunctional<p, dim>::SolidFunctional;
+
+  /// @brief The residual of the nonlinear solve
+  mfem::Operator& residual() { return *this->residual_; }
+};
+
+/// @brief Exposes the residual operator that the Newton solver of ThermalConductionFunctional evaluates
+template <int p, int dim>
+class ThermalFunctionalResidual : public ThermalConductionFunctional<p, dim> {
+public:
+  using ThermalConductionFunctional<p, dim>::ThermalConductionFunctional;
+
+  /// @brief The residual of the nonlinear solve
+  mfem::Operator& residual() { return this->residual_; }
+};
+
+TEST(functional_allocations, solid_dynamic_residual)
+{
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_functional_allocations");
+  serac::StateManager::setMesh(
+      mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/beam-quad.mesh"), 0, 0));
+
+  const IterativeSolverOptions linear_options = {.rel_tol     = 1.0e-8,
+                                                 .abs_tol     = 1.0e-12,
+                                                 .print_level = 0,
+                                                 .max_iter    = 500,
+                                                 .lin_solver  = LinearSolver::GMRES,
+                                                 .prec        = HypreBoomerAMGPrec{}};
+
+  const NonlinearSolverOptions nonlinear_options = {
+      .rel_tol = 1.0e-8, .abs_tol = 1.0e-12, .max_iter = 10, .print_level = 0};
+
+  const typename solid_util::TimesteppingOptions timestep = {
+      .timestepper = TimestepMethod::AverageAcceleration, .enforcement_method = DirichletEnforcementMethod::RateControl};
+
+  SolidFunctionalResidual<p, dim> solid_solver({linear_options, nonlinear_options, timestep},
+                                               GeometricNonlinearities::Off, FinalMeshOption::Reference,
+                                               "solid_functional_allocations");
+
+  solid_util::LinearIsotropicSolid<dim> mat(1.0, 1.0, 1.0);
+  solid_solver.setMaterial(mat);
+
+  auto bc = [](const mfem::Vector&, mfem::Vector& bc_vec) -> void { bc_vec = 0.0; };
+  solid_solver.setDisplacementBCs({1}, bc);
+  solid_solver.setDisplacement(bc);
+
+  tensor<double, dim> constant_force{};
+  constant_force[1] = 5.0e-1;
+  solid_util::ConstantBodyForce<dim> force{constant_force};
+  solid_solver.addBodyForce(force);
+
+  solid_solver.completeSetup();
+
+  double dt = 0.1;
+  solid_solver.advanceTimestep(dt);
+
+  EXPECT_EQ(residual_allocations(solid_solver.residual()), 0u);
+}
+
+TEST(functional_allocations, thermal_dynamic_residual)
+{
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_functional_allocations");
+  serac::StateManager::setMesh(
+      mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/star.mesh"), 1, 0));
+
+  ThermalFunctionalResidual<p, dim> thermal_solver(Thermal::defaultDynamicOptions(), "thermal_functional_allocations");
+
+  Thermal::LinearIsotropicConductor mat(0.5, 0.5, 0.5);
+  thermal_solver.setMaterial(mat);
+
+  auto temp = [](const mfem::Vector& x, double) -> double { return 1.0 + x[0]; };
+  thermal_solver.setTemperatureBCs({1}, temp);
+  thermal_solver.setTemperature(temp);
+
+  thermal_solver.completeSetup();
+
+  double dt = 0.1;
+  thermal_solver.advanceTimestep(dt);
+
+  EXPECT_EQ(residual_allocations(thermal_solver.residual()), 0u);
+}
+
+TEST(functional_allocations, thermal_sensitivity)
+{
+  constexpr int p   = 1;
+  constexpr int dim = 2;
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_sensitivity_allocations");
+  serac::StateManager::setMesh(
+      mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/star.mesh"), 2, 0));
+
+  FiniteElementState conductivity(
+      StateManager::newState(FiniteElementState::Options{.order = 1, .name = "sensitivity_conductivity"}));
+  conductivity = 1.0;
+
+  ThermalConductionFunctional<p, dim, H1<1>> thermal_solver(Thermal::defaultQuasistaticOptions(),
+                                                            "thermal_sensitivity_allocations", {conductivity});
+
+  Thermal::ParameterizedLinearIsotropicConductor mat;
+  thermal_solver.setMaterial(mat);
+
+  auto temp = [](const mfem::Vector& x, double) -> double { return 1.0 + x[0]; };
+  thermal_solver.setTemperatureBCs({1}, temp);
+  thermal_solver.setTemperature(temp);
+
+  Thermal::ConstantSource source{1.0};
+  thermal_solver.setSource(source);
+
+  thermal_solver.completeSetup();
+
+  double dt = 1.0;
+  thermal_solver.advanceTimestep(dt);
+
+  FiniteElementDual adjoint_load(
+      StateManager::newDual(FiniteElementState::Options{.order = 1, .name = "sensitivity_adjoint_load"}));
+  adjoint_load.trueVec() = 1.0;
+  thermal_solver.solveAdjoint(adjoint_load);
+
+  // the sensitivity is a vector-Jacobian product, so neither the element gradients w.r.t. the parameter
+  // nor the sparsity pattern of dR/dparameter should be allocated, each of which is at least this large
+  auto&       space                  = conductivity.space();
+  std::size_t element_gradient_bytes = sizeof(double) * static_cast<std::size_t>(space.GetNE()) *
+                                       static_cast<std::size_t>(space.GetFE(0)->GetDof()) *
+                                       static_cast<std::size_t>(space.GetFE(0)->GetDof());
+
+  num_allocated_bytes  = 0;
+  counting_allocations = true;
+  thermal_solver.computeSensitivity<0>();
+  counting_allocations = false;
+
+  EXPECT_LT(num_allocated_bytes, element_gradient_bytes);
+}
+
+}  // namespace serac
+
+//------------------------------------------------------------------------------
+#include "axom/slic/core/SimpleLogger.hpp"
+
+int main(int argc, char* argv[])
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  MPI_Init(&argc, &argv);
+
+  axom::slic::SimpleLogger logger;
+
+  int result = RUN_ALL_TESTS();
+  MPI_Finalize();
+
+  return result;
+}
@@ -179,6 +179,150 @@ void functional_solid_test_dynamic(double expected_disp_norm)
   EXPECT_NEAR(expected_disp_norm, norm(solid_solver.displacement()), 1.0e-6);
 }
 
+template <int p, int dim>
+double explicit_or_implicit_displacement_norm(bool lumped_mass, double dt, int steps)
+{
+  // define the solver configurations
+  const IterativeSolverOptions default_linear_options = {.rel_tol     = 1.0e-8,
+                                                         .abs_tol     = 1.0e-12,
+                                                         .print_level = 0,
+                                                         .max_iter    = 500,
+                                                         .lin_solver  = LinearSolver::GMRES,
+                                                         .prec        = HypreBoomerAMGPrec{}};
+
+  const NonlinearSolverOptions default_nonlinear_options = {
+      .rel_tol = 1.0e-8, .abs_tol = 1.0e-12, .max_iter = 10, .print_level = 1};
+
+  const typename solid_util::TimesteppingOptions timestep = {
+      .timestepper        = lumped_mass ? TimestepMethod::CentralDifference : TimestepMethod::AverageAcceleration,
+      .enforcement_method = DirichletEnforcementMethod::RateControl,
+      .adaptivity         = std::nullopt,
+      .lumped_mass        = lumped_mass};
+
+  const typename solid_util::SolverOptions options = {default_linear_options, default_nonlinear_options, timestep};
+
+  SolidFunctional<p, dim> solid_solver(options, GeometricNonlinearities::Off, FinalMeshOption::Reference,
+                                       lumped_mass ? "solid_functional_explicit" : "solid_functional_implicit");
+
+  solid_util::LinearIsotropicSolid<dim> mat(1.0, 1.0, 1.0);
+  solid_solver.setMaterial(mat);
+
+  auto bc = [](const mfem::Vector&, mfem::Vector& bc_vec) -> void { bc_vec = 0.0; };
+  solid_solver.setDisplacementBCs({1}, bc);
+  solid_solver.setDisplacement(bc);
+
+  tensor<double, dim> constant_force{};
+  constant_force[1] = 5.0e-1;
+
+  solid_util::ConstantBodyForce<dim> force{constant_force};
+  solid_solver.addBodyForce(force);
+
+  solid_solver.completeSetup();
+
+  if (lumped_mass) {
+    // the requested steps are much longer than the critical time step, and are subcycled
+    EXPECT_GT(solid_solver.criticalTimestep(), 0.0);
+    EXPECT_LT(solid_solver.criticalTimestep(), dt);
+  }
+
+  for (int i = 0; i < steps; ++i) {
+    solid_solver.advanceTimestep(dt);
+  }
+
+  return norm(solid_solver.displacement());
+}
+
+template <int p, int dim>
+void functional_solid_test_explicit()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_functional_explicit_solve");
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/beam-quad.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+  serac::StateManager::setMesh(mesh::refineAndDistribute(buildMeshFromFile(filename), 0, 0));
+
+  // the undamped beam oscillates about its loaded equilibrium instead of settling, so the reference is a
+  // well-resolved implicit solution with the consistent mass matrix, which central differences with the lumped
+  // mass matrix should follow to within the dispersion error of lumping
+  double implicit_norm = explicit_or_implicit_displacement_norm<p, dim>(false, 0.02, 75);
+  double explicit_norm = explicit_or_implicit_displacement_norm<p, dim>(true, 0.5, 3);
+
+  EXPECT_NEAR(explicit_norm, implicit_norm, 0.05 * implicit_norm);
+}
+
+/// runs a transient solve with a displacement BC, given either as a function of an mfem::Vector or as a
+/// q-function-style callable that is evaluated at the cached boundary nodes, and returns the final displacement
+template <int p, int dim>
+mfem::Vector transient_displacement_with_bc(bool nodal_bc)
+{
+  const IterativeSolverOptions default_linear_options = {.rel_tol     = 1.0e-10,
+                                                         .abs_tol     = 1.0e-14,
+                                                         .print_level = 0,
+                                                         .max_iter    = 500,
+                                                         .lin_solver  = LinearSolver::GMRES,
+                                                         .prec        = HypreBoomerAMGPrec{}};
+
+  const NonlinearSolverOptions default_nonlinear_options = {
+      .rel_tol = 1.0e-10, .abs_tol = 1.0e-14, .max_iter = 10, .print_level = 1};
+
+  const typename solid_util::TimesteppingOptions default_timestep = {TimestepMethod::AverageAcceleration,
+                                                                     DirichletEnforcementMethod::RateControl};
+
+  const typename solid_util::SolverOptions default_dynamic = {default_linear_options, default_nonlinear_options,
+                                                              default_timestep};
+
+  SolidFunctional<p, dim> solid_solver(default_dynamic, GeometricNonlinearities::Off, FinalMeshOption::Reference,
+                                       nodal_bc ? "solid_functional_nodal_bc" : "solid_functional_coefficient_bc");
+
+  solid_util::LinearIsotropicSolid<dim> mat(1.0, 1.0, 1.0);
+  solid_solver.setMaterial(mat);
+
+  // a shear of the clamped end
+  if (nodal_bc) {
+    solid_solver.setDisplacementBCs({1}, [](tensor<double, dim> x, double) {
+      tensor<double, dim> u{};
+      u[0] = 1.0e-2 * x[1];
+      return u;
+    });
+  } else {
+    solid_solver.setDisplacementBCs({1}, [](const mfem::Vector& x, mfem::Vector& u) {
+      u    = 0.0;
+      u[0] = 1.0e-2 * x[1];
+    });
+  }
+  solid_solver.setDisplacement([](const mfem::Vector&, mfem::Vector& u) { u = 0.0; });
+
+  solid_solver.completeSetup();
+
+  double dt = 0.5;
+  for (int i = 0; i < 3; ++i) {
+    solid_solver.advanceTimestep(dt);
+  }
+
+  return solid_solver.displacement().gridFunc();
+}
+
+template <int p, int dim>
+void functional_solid_test_nodal_bc()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "solid_functional_nodal_bc_solve");
+
+  std::string filename =
+      (dim == 2) ? SERAC_REPO_DIR "/data/meshes/beam-quad.mesh" : SERAC_REPO_DIR "/data/meshes/beam-hex.mesh";
+  serac::StateManager::setMesh(mesh::refineAndDistribute(buildMeshFromFile(filename), 0, 0));
+
+  mfem::Vector difference = transient_displacement_with_bc<p, dim>(true);
+  difference -= transient_displacement_with_bc<p, dim>(false);
+
+  EXPECT_LT(difference.Normlinf(), 1.0e-8);
+}
+
 enum class TestType
 {
   Pressure,
@@ -237,15 +381,15 @@ void functional_solid_test_boundary(double expected_disp_norm, TestType test_mod
   solid_solver.setDisplacement(bc);
 
   if (test_mode == TestType::Pressure) {
-    solid_util::PressureFunction<dim> pressure{[](const tensor<double, dim>& x, const double) {
+    auto pressure = solid_util::makePressureFunction<dim>([](const tensor<double, dim>& x, const double) {
       if (x[0] > 7.5) {
         return 1.0e-2;
       }
       return 0.0;
-    }};
+    });
     solid_solver.setPressureBCs(pressure);
   } else if (test_mode == TestType::Traction) {
-    solid_util::TractionFunction<dim> traction_function{
+    auto traction_function = solid_util::makeTractionFunction<dim>(
         [](const tensor<double, dim>& x, const tensor<double, dim>&, const double) {
           tensor<double, dim> traction;
           for (int i = 0; i < dim; ++i) {
@@ -256,7 +400,7 @@ void functional_solid_test_boundary(double expected_disp_norm, TestType test_mod
             traction[1] = 1.0e-4;
           }
           return traction;
-        }};
+        });
     solid_solver.setTractionBCs(traction_function);
   } else {
     // Default to fail if non-implemented TestType is not implemented
@@ -380,6 +524,11 @@ TEST(solid_functional, 2D_quad_dynamic) { functional_solid_test_dynamic<2, 2>(1.
 TEST(solid_functional, 3D_linear_dynamic) { functional_solid_test_dynamic<1, 3>(1.52490653); }
 TEST(solid_functional, 3D_quad_dynamic) { functional_solid_test_dynamic<2, 3>(1.53140614); }
 
+TEST(solid_functional, 2D_linear_explicit) { functional_solid_test_explicit<1, 2>(); }
+
+TEST(solid_functional, 2D_quad_nodal_bc) { functional_solid_test_nodal_bc<2, 2>(); }
+TEST(solid_functional, 3D_linear_nodal_bc) { functional_solid_test_nodal_bc<1, 3>(); }
+
 TEST(solid_functional, 2D_linear_pressure) { functional_solid_test_boundary<1, 2>(0.065134188, TestType::Pressure); }
 TEST(solid_functional, 2D_linear_traction) { functional_solid_test_boundary<1, 2>(0.126610139, TestType::Traction); }
 
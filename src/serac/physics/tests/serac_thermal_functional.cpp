@@ -155,6 +155,111 @@ void functional_test_dynamic(double expected_temp_norm)
   EXPECT_NEAR(expected_temp_norm, norm(thermal_solver.temperature()), 1.0e-6);
 }
 
+/// returns the temperature driven by a constant source, either at steady state or after an explicit transient solve
+/// with the lumped mass matrix
+template <int p, int dim>
+mfem::Vector source_driven_temperature(bool lumped_mass, double dt, int steps)
+{
+  Thermal::SolverOptions options = Thermal::defaultQuasistaticOptions();
+  if (lumped_mass) {
+    options                          = Thermal::defaultDynamicOptions();
+    options.dyn_options->timestepper = TimestepMethod::RK4;
+    options.dyn_options->lumped_mass = true;
+  }
+
+  ThermalConductionFunctional<p, dim> thermal_solver(
+      options, lumped_mass ? "thermal_functional_explicit" : "thermal_functional_steady");
+
+  Thermal::LinearIsotropicConductor mat(0.5, 0.5, 0.5);
+  thermal_solver.setMaterial(mat);
+
+  auto one = [](const mfem::Vector&, double) -> double { return 1.0; };
+  thermal_solver.setTemperatureBCs({1}, one);
+  thermal_solver.setTemperature(one);
+
+  Thermal::ConstantSource source{1.0};
+  thermal_solver.setSource(source);
+
+  thermal_solver.completeSetup();
+
+  if (lumped_mass) {
+    // the requested steps are much longer than the stable time step, and are subcycled
+    EXPECT_GT(thermal_solver.stableTimestep(), 0.0);
+    EXPECT_LT(thermal_solver.stableTimestep(), dt);
+  }
+
+  for (int i = 0; i < steps; ++i) {
+    thermal_solver.advanceTimestep(dt);
+  }
+
+  return thermal_solver.temperature().gridFunc();
+}
+
+template <int p, int dim>
+void functional_test_explicit()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_functional_explicit_solve");
+
+  serac::StateManager::setMesh(
+      mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/star.mesh"), 1, 0));
+
+  // lumping the mass matrix changes the transient but not the steady state, which the explicit solve reaches
+  // after many multiples of the slowest decay time of the conduction problem
+  mfem::Vector steady     = source_driven_temperature<p, dim>(false, 1.0, 1);
+  mfem::Vector difference = source_driven_temperature<p, dim>(true, 1.0, 4);
+  difference -= steady;
+
+  EXPECT_LT(difference.Normlinf(), 1.0e-6 * steady.Normlinf());
+}
+
+/// runs a transient solve with a time-dependent temperature BC, given either as a function of an mfem::Vector or as a
+/// q-function-style callable that is evaluated at the cached boundary nodes, and returns the final temperature
+template <int p, int dim>
+mfem::Vector transient_temperature_with_bc(bool nodal_bc)
+{
+  ThermalConductionFunctional<p, dim> thermal_solver(
+      Thermal::defaultDynamicOptions(), nodal_bc ? "thermal_functional_nodal_bc" : "thermal_functional_coefficient_bc");
+
+  Thermal::LinearIsotropicConductor mat(0.5, 0.5, 0.5);
+  thermal_solver.setMaterial(mat);
+
+  if (nodal_bc) {
+    thermal_solver.setTemperatureBCs({1}, [](tensor<double, dim> x, double t) { return 1.0 + t * x[0]; });
+  } else {
+    thermal_solver.setTemperatureBCs({1}, [](const mfem::Vector& x, double t) { return 1.0 + t * x[0]; });
+  }
+  thermal_solver.setTemperature([](const mfem::Vector&, double) { return 1.0; });
+
+  thermal_solver.completeSetup();
+
+  double dt = 0.25;
+  for (int i = 0; i < 4; ++i) {
+    thermal_solver.advanceTimestep(dt);
+  }
+
+  return thermal_solver.temperature().gridFunc();
+}
+
+template <int p, int dim>
+void functional_test_nodal_bc()
+{
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  axom::sidre::DataStore datastore;
+  serac::StateManager::initialize(datastore, "thermal_functional_nodal_bc_solve");
+
+  serac::StateManager::setMesh(
+      mesh::refineAndDistribute(buildMeshFromFile(SERAC_REPO_DIR "/data/meshes/star.mesh"), 1, 0));
+
+  mfem::Vector difference = transient_temperature_with_bc<p, dim>(true);
+  difference -= transient_temperature_with_bc<p, dim>(false);
+
+  EXPECT_LT(difference.Normlinf(), 1.0e-10);
+}
+
 TEST(thermal_functional, 2D_linear_static) { functional_test_static<1, 2>(2.2909240); }
 TEST(thermal_functional, 2D_quad_static) { functional_test_static<2, 2>(2.29424403); }
 TEST(thermal_functional, 3D_linear_static) { functional_test_static<1, 3>(46.6285642); }
@@ -165,6 +270,10 @@ TEST(thermal_functional, 2D_quad_dynamic) { functional_test_dynamic<2, 2>(2.1806
 TEST(thermal_functional, 3D_linear_dynamic) { functional_test_dynamic<1, 3>(3.1447306); }
 TEST(thermal_functional, 3D_quad_dynamic) { functional_test_dynamic<2, 3>(3.36129252); }
 
+TEST(thermal_functional, 2D_linear_explicit) { functional_test_explicit<1, 2>(); }
+
+TEST(thermal_functional, 2D_quad_nodal_bc) { functional_test_nodal_bc<2, 2>(); }
+
 TEST(thermal_functional, parameterized_material)
 {
   MPI_Barrier(MPI_COMM_WORLD);
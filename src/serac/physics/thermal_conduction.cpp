@@ -37,6 +37,9 @@ ThermalConduction::ThermalConduction(int order, const SolverOptions& options, co
   if (options.dyn_options) {
     ode_.SetTimestepper(options.dyn_options->timestepper);
     ode_.SetEnforcementMethod(options.dyn_options->enforcement_method);
+    if (options.dyn_options->adaptivity) {
+      ode_.SetAdaptivity(*options.dyn_options->adaptivity, mesh_.GetComm());
+    }
     is_quasistatic_ = false;
   } else {
     is_quasistatic_ = true;
@@ -197,7 +200,7 @@ void ThermalConduction::completeSetup()
 
         [this](const mfem::Vector& u) -> mfem::Operator& {
           auto& J = dynamic_cast<mfem::HypreParMatrix&>(K_form_->GetGradient(u));
-          bcs_.eliminateAllEssentialDofsFromMatrix(J);
+          bcs_.eliminateAllEssentialDofsFromMatrix(J, J_elimination_);
           return J;
         });
 
@@ -227,7 +230,7 @@ void ThermalConduction::completeSetup()
             auto localJ = std::unique_ptr<mfem::SparseMatrix>(
                 mfem::Add(1.0, M_form_->SpMat(), dt_, K_form_->GetLocalGradient(u_ + dt_ * du_dt)));
             J_.reset(M_form_->ParallelAssemble(localJ.get()));
-            bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+            bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
           }
           return *J_;
         });
@@ -280,6 +283,9 @@ void ThermalConduction::InputOptions::defineInputFileSchema(axom::inlet::Contain
   auto& dynamics_container = container.addStruct("dynamics", "Parameters for mass matrix inversion");
   dynamics_container.addString("timestepper", "Timestepper (ODE) method to use");
   dynamics_container.addString("enforcement_method", "Time-varying constraint enforcement method to use");
+  auto& adaptivity_container =
+      dynamics_container.addStruct("adaptivity", "Parameters for error-controlled adaptive time stepping");
+  serac::mfem_ext::TimestepController::DefineInputFileSchema(adaptivity_container);
 
   auto& bc_container = container.addStructDictionary("boundary_conds", "Container of boundary conditions");
   serac::input::BoundaryConditionInputOptions::defineInputFileSchema(bc_container);
@@ -314,7 +320,10 @@ serac::ThermalConduction::InputOptions FromInlet<serac::ThermalConduction::Input
     const static std::map<std::string, TimestepMethod> timestep_methods = {
         {"AverageAcceleration", TimestepMethod::AverageAcceleration},
         {"BackwardEuler", TimestepMethod::BackwardEuler},
-        {"ForwardEuler", TimestepMethod::ForwardEuler}};
+        {"ForwardEuler", TimestepMethod::ForwardEuler},
+        {"SDIRK23", TimestepMethod::SDIRK23},
+        {"SDIRK34", TimestepMethod::SDIRK34},
+        {"GeneralizedAlpha", TimestepMethod::GeneralizedAlpha}};
     std::string timestep_method = dynamics["timestepper"];
     SLIC_ERROR_ROOT_IF(timestep_methods.count(timestep_method) == 0,
                        "Unrecognized timestep method: " << timestep_method);
@@ -328,6 +337,10 @@ serac::ThermalConduction::InputOptions FromInlet<serac::ThermalConduction::Input
                        "Unrecognized enforcement method: " << enforcement_method);
     dyn_options.enforcement_method = enforcement_methods.at(enforcement_method);
 
+    if (dynamics.contains("adaptivity")) {
+      dyn_options.adaptivity = dynamics["adaptivity"].get<serac::AdaptiveTimestepOptions>();
+    }
+
     result.solver_options.dyn_options = std::move(dyn_options);
   }
 
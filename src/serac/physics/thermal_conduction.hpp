@@ -47,6 +47,13 @@ public:
      *
      */
     DirichletEnforcementMethod enforcement_method;
+
+    /**
+     * @brief The parameters of error-controlled adaptive time stepping
+     * @note If this is not defined, the time steps are fixed
+     *
+     */
+    std::optional<AdaptiveTimestepOptions> adaptivity = std::nullopt;
   };
 
   /**
@@ -387,6 +394,11 @@ protected:
    */
   std::unique_ptr<mfem::HypreParMatrix> J_;
 
+  /**
+   * @brief Essential DOF elimination positions of the Jacobian, reused while its sparsity is unchanged
+   */
+  EliminationPattern J_elimination_;
+
   /**
    * @brief The current timestep
    */
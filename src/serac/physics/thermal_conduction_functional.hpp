@@ -33,6 +33,16 @@ struct TimesteppingOptions {
 
   /// The essential boundary enforcement method to use
   serac::DirichletEnforcementMethod enforcement_method;
+
+  /// The parameters of error-controlled adaptive time stepping, which is disabled if this is not defined
+  std::optional<serac::AdaptiveTimestepOptions> adaptivity = std::nullopt;
+
+  /**
+   * @brief Whether to integrate explicitly with a row-summed (lumped) mass matrix
+   * @note This requires one of the explicit Runge-Kutta timesteppers. Each stage is then a single residual evaluation
+   * and a diagonal scaling, and steps longer than the stable time step are subcycled.
+   */
+  bool lumped_mass = false;
 };
 
 /**
@@ -54,6 +64,9 @@ struct SolverOptions {
    * @note If this is not defined, a quasi-static solve is performed
    */
   std::optional<TimesteppingOptions> dyn_options = std::nullopt;
+
+  /// The initial guess of the nonlinear solve in each time step of a dynamic solve
+  PredictorType predictor = PredictorType::Previous;
 };
 
 /**
@@ -142,7 +155,9 @@ public:
         parameter_states_(parameter_states),
         residual_(temperature_.space().TrueVSize()),
         ode_(temperature_.space().TrueVSize(), {.u = u_, .dt = dt_, .du_dt = previous_, .previous_dt = previous_dt_},
-             nonlin_solver_, bcs_)
+             nonlin_solver_, bcs_),
+        explicit_ode_(temperature_.space().TrueVSize(),
+                      [this](double t, const mfem::Vector& u, mfem::Vector& f) { explicitResidual(t, u, f); }, bcs_)
   {
     SLIC_ERROR_ROOT_IF(mesh_.Dimension() != dim,
                        axom::fmt::format("Compile time dimension and runtime mesh dimension mismatch"));
@@ -167,13 +182,28 @@ public:
 
     state_.push_back(temperature_);
 
-    nonlin_solver_ = mfem_ext::EquationSolver(mesh_.GetComm(), options.T_lin_options, options.T_nonlin_options);
+    // If the user wants an element-based preconditioner, give it access to the element gradients
+    auto lin_options = mfem_ext::AugmentElementPreconditioner(
+        options.T_lin_options, temperature_.space(),
+        [this]() -> const mfem::SparseMatrix& { return localJacobian(); }, bcs_.allEssentialDofs());
+
+    nonlin_solver_ = mfem_ext::EquationSolver(mesh_.GetComm(), lin_options, options.T_nonlin_options);
     nonlin_solver_.SetOperator(residual_);
 
     // Check for dynamic mode
     if (options.dyn_options) {
+      lumped_mass_ = options.dyn_options->lumped_mass;
+      SLIC_ERROR_ROOT_IF(lumped_mass_ && options.dyn_options->adaptivity,
+                         "The lumped mass matrix does not support adaptive time stepping");
+      if (lumped_mass_) {
+        explicit_ode_.SetTimestepper(options.dyn_options->timestepper);
+      }
       ode_.SetTimestepper(options.dyn_options->timestepper);
       ode_.SetEnforcementMethod(options.dyn_options->enforcement_method);
+      ode_.SetPredictor(options.predictor);
+      if (options.dyn_options->adaptivity) {
+        ode_.SetAdaptivity(*options.dyn_options->adaptivity, mesh_.GetComm());
+      }
       is_quasistatic_ = false;
     } else {
       is_quasistatic_ = true;
@@ -184,6 +214,7 @@ public:
 
     int true_size = temperature_.space().TrueVSize();
     u_.SetSize(true_size);
+    K_arg_.SetSize(true_size);
     previous_.SetSize(true_size);
     previous_ = 0.0;
 
@@ -203,6 +234,31 @@ public:
     temp_bdr_coef_ = std::make_shared<mfem::FunctionCoefficient>(temp);
 
     bcs_.addEssential(temp_bdr, temp_bdr_coef_, temperature_);
+    invalidateMassMatrix();
+  }
+
+  /**
+   * @brief Set essential temperature boundary conditions from a q-function-style callable
+   *
+   * The callable is evaluated directly at the nodes of the constrained DOFs whenever the boundary values are updated
+   * during time integration, without a coefficient or an element transformation per node.
+   *
+   * @tparam Func The type of the callable, invoked as temp(tensor<double, dim> x, double t) -> double
+   * @param[in] temp_bdr The boundary attributes on which to enforce a temperature
+   * @param[in] temp The prescribed boundary temperature function
+   */
+  template <typename Func,
+            typename = std::enable_if_t<std::is_invocable_r_v<double, Func, tensor<double, dim>, double>>>
+  void setTemperatureBCs(const std::set<int>& temp_bdr, Func temp)
+  {
+    // the coefficient is still used for the projections over the boundary elements
+    temp_bdr_coef_ = std::make_shared<mfem::FunctionCoefficient>([temp](const mfem::Vector& x, double t) {
+      return temp(make_tensor<dim>([&x](int i) { return x[i]; }), t);
+    });
+
+    bcs_.addEssential(temp_bdr, temp_bdr_coef_, temperature_);
+    bcs_.essentials().back().setNodalFunction<dim>(temp);
+    invalidateMassMatrix();
   }
 
   /**
@@ -220,7 +276,11 @@ public:
       SLIC_ASSERT_MSG(gf_initialized_[0], "Thermal state not initialized!");
 
       // Step the time integrator
-      ode_.Step(temperature_.trueVec(), time_, dt);
+      if (lumped_mass_) {
+        explicit_ode_.Step(temperature_.trueVec(), time_, dt);
+      } else {
+        ode_.Step(temperature_.trueVec(), time_, dt);
+      }
     }
 
     temperature_.distributeSharedDofs();
@@ -278,8 +338,17 @@ public:
           return serac::tuple{source, flux};
         },
         mesh_);
+
+    invalidateMassMatrix();
   }
 
+  /**
+   * @brief Discard the cached mass matrix of implicit dynamics, so it is reassembled by the next Jacobian evaluation
+   * @note Changes of the parameter fields are detected automatically, but this must be called after the
+   * geometry of the mesh changes
+   */
+  void invalidateMassMatrix() { M_local_ = nullptr; }
+
   /**
    * @brief Set the underlying finite element state to a prescribed temperature
    *
@@ -393,7 +462,19 @@ public:
     // Initialize the true vector
     temperature_.initializeTrueVec();
 
-    if (is_quasistatic_) {
+    if (lumped_mass_) {
+      computeLumpedMass();
+
+      // the stability limit is estimated from the tangent conductivity at the initial temperature
+      functional_call_args_[0] = temperature_.trueVec();
+      auto [r, drdu]           = (*K_functional_)(functional_call_args_, Index<0>{});
+      std::unique_ptr<mfem::HypreParMatrix> K(assemble(drdu));
+      explicit_ode_.SetSpectralRadius(
+          mfem_ext::LumpedSpectralRadiusBound(*K, inv_lumped_mass_, bcs_.allEssentialDofs()));
+    }
+
+    // explicit stages need no nonlinear solve, so they keep the conduction operator for solveAdjoint
+    if (is_quasistatic_ || lumped_mass_) {
       residual_ = mfem_ext::StdFunctionOperator(
           temperature_.space().TrueVSize(),
 
@@ -409,7 +490,8 @@ public:
 
             auto [r, drdu] = (*K_functional_)(functional_call_args_, Index<0>{});
             J_             = assemble(drdu);
-            bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+            J_local_       = &drdu.localMatrix();
+            bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
             return *J_;
           });
 
@@ -420,15 +502,14 @@ public:
           [this](const mfem::Vector& du_dt, mfem::Vector& r) {
             functional_call_args_[0] = du_dt;
 
-            auto M_residual = (*M_functional_)(functional_call_args_);
+            const mfem::Vector& M_residual = (*M_functional_)(functional_call_args_);
 
             // TODO we should use the new variadic capability to directly pass temperature and d_temp_dt directly to
             // these kernels to avoid ugly hacks like this.
-            mfem::Vector K_arg(u_.Size());
-            add(1.0, u_, dt_, du_dt, K_arg);
-            functional_call_args_[0] = K_arg;
+            add(1.0, u_, dt_, du_dt, K_arg_);
+            functional_call_args_[0] = K_arg_;
 
-            auto K_residual = (*K_functional_)(functional_call_args_);
+            const mfem::Vector& K_residual = (*K_functional_)(functional_call_args_);
 
             functional_call_args_[0] = u_;
 
@@ -437,29 +518,34 @@ public:
           },
 
           [this](const mfem::Vector& du_dt) -> mfem::Operator& {
-            // Only reassemble the stiffness if it is a new timestep
-            functional_call_args_[0] = du_dt;
+            const mfem::SparseMatrix& M = massMatrix();
 
-            auto M = serac::get<1>((*M_functional_)(functional_call_args_, Index<0>{}));
-            std::unique_ptr<mfem::HypreParMatrix> m_mat(assemble(M));
+            add(1.0, u_, dt_, du_dt, K_arg_);
+            functional_call_args_[0] = K_arg_;
 
-            mfem::Vector K_arg(u_.Size());
-            add(1.0, u_, dt_, du_dt, K_arg);
-            functional_call_args_[0] = K_arg;
-
-            auto K = serac::get<1>((*K_functional_)(functional_call_args_, Index<0>{}));
+            auto [r, K] = (*K_functional_)(functional_call_args_, Index<0>{});
 
             functional_call_args_[0] = u_;
 
-            std::unique_ptr<mfem::HypreParMatrix> k_mat(assemble(K));
-
-            J_.reset(mfem::Add(1.0, *m_mat, dt_, *k_mat));
-            bcs_.eliminateAllEssentialDofsFromMatrix(*J_);
+            // the mass and conduction gradients share a sparsity pattern, so J = M + dt K is summed in one assembly
+            J_       = K.assemble(1.0, M, dt_);
+            J_local_ = &K.localMatrix();
+            bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
             return *J_;
           });
     }
   }
 
+  /**
+   * @brief The processor-local Jacobian, summed directly from the most recently computed element gradients
+   * @note This is used by element-based preconditioners, which avoid global assembly
+   */
+  const mfem::SparseMatrix& localJacobian()
+  {
+    SLIC_ERROR_ROOT_IF(!J_local_, "The Jacobian must be evaluated before its processor-local part is available");
+    return *J_local_;
+  }
+
   /**
    * @brief Solve the adjoint problem
    * @pre It is expected that the forward analysis is complete and the current temperature state is valid
@@ -481,28 +567,35 @@ public:
 
     auto& lin_solver = nonlin_solver_.LinearSolver();
 
-    // By default, use a homogeneous essential boundary condition
-    mfem::HypreParVector adjoint_essential(adjoint_load.trueVec());
-    adjoint_essential = 0.0;
-
     functional_call_args_[0] = temperature_.trueVec();
 
     auto [r, drdu] = (*K_functional_)(functional_call_args_, Index<0>{});
-    auto jacobian  = assemble(drdu);
-    auto J_T       = std::unique_ptr<mfem::HypreParMatrix>(jacobian->Transpose());
 
-    // If we have a non-homogeneous essential boundary condition, extract it from the given state
+    // The transposed Jacobian is applied matrix-free by the element kernels, with the essential DOFs constrained
+    mfem::TransposeOperator   drdu_T(drdu);
+    mfem::ConstrainedOperator J_T(&drdu_T, bcs_.allEssentialDofs());
+
+    // If we have a non-homogeneous essential boundary condition, extract it from the given state, otherwise
+    // use a homogeneous one
     if (dual_with_essential_boundary) {
       dual_with_essential_boundary->initializeTrueVec();
-      adjoint_essential = dual_with_essential_boundary->trueVec();
+      J_T.EliminateRHS(dual_with_essential_boundary->trueVec(), adjoint_load_vector);
+    } else {
+      adjoint_load_vector.SetSubVector(bcs_.allEssentialDofs(), 0.0);
     }
 
-    for (const auto& bc : bcs_.essentials()) {
-      bc.eliminateFromMatrix(*J_T);
-      bc.eliminateToRHS(*J_T, adjoint_essential, adjoint_load_vector);
+    // The preconditioner is built from the assembled Jacobian, which approximates its transpose
+    J_       = assemble(drdu);
+    J_local_ = &drdu.localMatrix();
+    bcs_.eliminateAllEssentialDofsFromMatrix(*J_, J_elimination_);
+
+    // Only direct solvers need the transposed matrix, which is the transpose of the eliminated Jacobian
+    std::unique_ptr<mfem::HypreParMatrix> J_T_matrix;
+    if (!nonlin_solver_.SetLinearOperator(J_T, *J_)) {
+      J_T_matrix.reset(J_->Transpose());
+      lin_solver.SetOperator(*J_T_matrix);
     }
 
-    lin_solver.SetOperator(*J_T);
     lin_solver.Mult(adjoint_load_vector, adjoint_temperature_.trueVec());
 
     adjoint_temperature_.distributeSharedDofs();
@@ -529,19 +622,96 @@ public:
 
     auto [r, drdparam] = (*K_functional_)(functional_call_args_, Index<parameter_field + 1>{});
 
-    auto drdparam_mat = assemble(drdparam);
-
-    drdparam_mat->MultTranspose(adjoint_temperature_.trueVec(), parameter_sensitivities_[parameter_field]->trueVec());
+    // the vector-Jacobian product is computed by the element kernels, without assembling the rectangular dR/dparameter
+    drdparam.MultTranspose(adjoint_temperature_.trueVec(), parameter_sensitivities_[parameter_field]->trueVec());
 
     parameter_sensitivities_[parameter_field]->distributeSharedDofs();
 
     return *parameter_sensitivities_[parameter_field];
   }
 
+  /**
+   * @brief The largest stable time step of explicit time integration with the lumped mass matrix
+   * @note Steps passed to advanceTimestep() that exceed this are subcycled
+   */
+  double stableTimestep() const
+  {
+    SLIC_ERROR_ROOT_IF(!lumped_mass_, "The stable time step is only available for explicit integration with a lumped "
+                                      "mass matrix");
+    return explicit_ode_.StableTimestep();
+  }
+
   /// Destroy the Thermal Solver object
   virtual ~ThermalConductionFunctional() = default;
 
 protected:
+  /**
+   * @brief The processor-local mass matrix, which is cached between Jacobian evaluations
+   *
+   * The mass matrix only depends on the density, specific heat and geometry, so it is reassembled only when the
+   * parameter fields have changed since the last assembly or invalidateMassMatrix() was called.
+   *
+   * @return The processor-local mass matrix, which shares the sparsity pattern of the residual gradient
+   */
+  const mfem::SparseMatrix& massMatrix()
+  {
+    int changed = !M_local_;
+    for (size_t i = 0; i < sizeof...(parameter_space); ++i) {
+      const mfem::Vector& parameter = parameter_states_[i].get().trueVec();
+      changed |= (parameter.Size() != M_parameters_[i].Size()) ||
+                 !std::equal(parameter.begin(), parameter.end(), M_parameters_[i].begin());
+    }
+
+    // evaluating the mass functional is collective, so every rank reassembles if any rank has a changed parameter
+    MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_MAX, mesh_.GetComm());
+    if (!changed) {
+      return *M_local_;
+    }
+
+    // the mass term is linear in the temperature rate, so its gradient is independent of the linearization point
+    functional_call_args_[0] = zero_;
+    auto [r, M]              = (*M_functional_)(functional_call_args_, Index<0>{});
+    M_local_                 = &M.assembleLocal();
+    functional_call_args_[0] = u_;
+
+    for (size_t i = 0; i < sizeof...(parameter_space); ++i) {
+      M_parameters_[i] = parameter_states_[i].get().trueVec();
+    }
+    return *M_local_;
+  }
+
+  /**
+   * @brief Compute the row-summed lumped mass matrix of explicit time integration
+   */
+  void computeLumpedMass()
+  {
+    functional_call_args_[0] = zero_;
+    auto [r, dMdu]           = (*M_functional_)(functional_call_args_, Index<0>{});
+    mfem::Vector lumped_mass;
+    mfem_ext::LumpedMass(dMdu, mesh_.GetComm(), lumped_mass, inv_lumped_mass_);
+    functional_call_args_[0] = temperature_.trueVec();
+
+    explicit_ode_.SetLumpedMass(lumped_mass);
+  }
+
+  /**
+   * @brief Evaluate the residual of an explicit stage, where the sources see the time of the stage
+   * @param[in] t The time of the stage
+   * @param[in] u The temperature of the stage
+   * @param[out] r The conduction and source residual
+   */
+  void explicitResidual(double t, const mfem::Vector& u, mfem::Vector& r)
+  {
+    const double step_time = time_;
+    time_                  = t;
+
+    functional_call_args_[0] = u;
+    r                        = (*K_functional_)(functional_call_args_);
+    functional_call_args_[0] = temperature_.trueVec();
+
+    time_ = step_time;
+  }
+
   /// The compile-time finite element trial space for thermal conduction (H1 of order p)
   using trial = H1<order>;
 
@@ -572,6 +742,9 @@ protected:
   /// Assembled mass matrix
   std::unique_ptr<mfem::HypreParMatrix> M_;
 
+  /// The parameter fields the cached mass matrix was assembled with
+  std::array<mfem::Vector, sizeof...(parameter_space)> M_parameters_;
+
   /// Coefficient containing the essential boundary values
   std::shared_ptr<mfem::Coefficient> temp_bdr_coef_;
 
@@ -588,12 +761,30 @@ protected:
    */
   mfem_ext::FirstOrderODE ode_;
 
+  /// The first order ODE integrated explicitly with the lumped mass matrix
+  mfem_ext::LumpedMassFirstOrderODE explicit_ode_;
+
+  /// Whether dynamic problems are integrated explicitly with the lumped mass matrix
+  bool lumped_mass_ = false;
+
+  /// The inverse of the row-summed lumped mass matrix
+  mfem::Vector inv_lumped_mass_;
+
   /// the specific methods and tolerances specified to solve the nonlinear residual equations
   mfem_ext::EquationSolver nonlin_solver_;
 
   /// Assembled sparse matrix for the Jacobian
   std::unique_ptr<mfem::HypreParMatrix> J_;
 
+  /// The essential DOF elimination positions of the Jacobian, which keeps its sparsity between Newton iterations
+  EliminationPattern J_elimination_;
+
+  /// Processor-local mass matrix, cached between Jacobian evaluations and owned by the mass gradient
+  const mfem::SparseMatrix* M_local_ = nullptr;
+
+  /// Processor-local Jacobian of the most recent Jacobian evaluation, owned by the stiffness gradient
+  const mfem::SparseMatrix* J_local_ = nullptr;
+
   /// The current timestep
   double dt_;
 
@@ -606,6 +797,9 @@ protected:
   /// Predicted temperature true dofs
   mfem::Vector u_;
 
+  /// Workspace for the temperature the conduction is evaluated at in dynamic residual and Jacobian evaluations
+  mfem::Vector K_arg_;
+
   /// Previous value of du_dt used to prime the pump for the nonlinear solver
   mfem::Vector previous_;
 };